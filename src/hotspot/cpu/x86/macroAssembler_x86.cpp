@@ -6097,12 +6097,14 @@ void MacroAssembler::vectorized_mismatch(Register obja, Register objb, Register
 
   if ((AVX3Threshold == 0) && (UseAVX > 2) &&
       VM_Version::supports_avx512vlbw()) {
-    Label VECTOR64_LOOP, VECTOR64_NOT_EQUAL, VECTOR32_TAIL;
+    Label VECTOR64_LOOP, VECTOR64_NOT_EQUAL, VECTOR64_TAIL;
 
+    // Arrays shorter than 64 bytes are compared with a single masked
+    // compare instead of the 32/16/8/4/1-byte ladder below.
+    movq(tmp1, length);
     cmpq(length, 64);
-    jcc(Assembler::less, VECTOR32_TAIL);
+    jcc(Assembler::less, VECTOR64_TAIL);
 
-    movq(tmp1, length);
     andq(tmp1, 0x3F);      // tail count
     andq(length, ~(0x3F)); //vector count
 
@@ -6116,11 +6118,10 @@ void MacroAssembler::vectorized_mismatch(Register obja, Register objb, Register
     subq(length, 64);
     jccb(Assembler::notZero, VECTOR64_LOOP);
 
-    //bind(VECTOR64_TAIL);
     testq(tmp1, tmp1);
     jcc(Assembler::zero, SAME_TILL_END);
 
-    //bind(VECTOR64_TAIL);
+    bind(VECTOR64_TAIL);
     // AVX512 code to compare upto 63 byte vectors.
     mov64(tmp2, 0xFFFFFFFFFFFFFFFF);
     shlxq(tmp2, tmp2, tmp1);
@@ -6140,7 +6141,6 @@ void MacroAssembler::vectorized_mismatch(Register obja, Register objb, Register
     addq(result, tmp1);
     shrq(result);
     jmp(DONE);
-    bind(VECTOR32_TAIL);
   }
 
   cmpq(length, 8);
@@ -4369,6 +4369,221 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - byte[]  source+offset
+  //   c_rarg1   - long[]  SHA3.state
+  //   c_rarg2   - int     digest_length
+  //   c_rarg3   - int     offset
+  //   c_rarg4   - int     limit
+  //
+  // The Keccak state is kept as five rows of five lanes in the low five
+  // 64-bit lanes of zmm0-zmm4; the upper three lanes of each row are unused.
+  address generate_sha3_implCompress(bool multi_block, const char *name) {
+    assert(VM_Version::supports_evex(), "");
+    static const uint64_t keccak_consts[] = {
+      // rho rotation counts, one row of the state per line
+       0,  1, 62, 28, 27, 0, 0, 0,
+      36, 44,  6, 55, 20, 0, 0, 0,
+       3, 10, 43, 25, 39, 0, 0, 0,
+      41, 45, 15, 21,  8, 0, 0, 0,
+      18,  2, 61, 56, 14, 0, 0, 0,
+      // lane permutations, lane x <- lane (x + k) % 5 for k = 1..4
+      1, 2, 3, 4, 0, 5, 6, 7,
+      2, 3, 4, 0, 1, 5, 6, 7,
+      3, 4, 0, 1, 2, 5, 6, 7,
+      4, 0, 1, 2, 3, 5, 6, 7,
+      // iota round constants
+      0x0000000000000001, 0x0000000000008082, 0x800000000000808A,
+      0x8000000080008000, 0x000000000000808B, 0x0000000080000001,
+      0x8000000080008081, 0x8000000000008009, 0x000000000000008A,
+      0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+      0x000000008000808B, 0x800000000000008B, 0x8000000000008089,
+      0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+      0x000000000000800A, 0x800000008000000A, 0x8000000080008081,
+      0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+    };
+    const int rot_offset  = 0;
+    const int perm_offset = 40 * wordSize;
+    const int rc_offset   = 72 * wordSize;
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    const Register buf           = c_rarg0;
+    const Register state         = c_rarg1;
+    const Register digest_length = c_rarg2;
+    const Register ofs           = c_rarg3;
+#ifndef _WIN64
+    const Register limit         = c_rarg4;
+#else
+    const Address  limit_mem(rbp, 6 * wordSize); // limit is on stack on Win64
+    const Register limit         = r10;
+#endif
+    const Register consts        = r11;
+    const Register round         = rax;
+
+    // Only vector registers that are volatile on every x86_64 ABI are used.
+    const XMMRegister row[5]  = { xmm0, xmm1, xmm2, xmm3, xmm4 };
+    const XMMRegister rot[5]  = { xmm16, xmm17, xmm18, xmm19, xmm20 };
+    const XMMRegister perm[5] = { xnoreg, xmm21, xmm22, xmm23, xmm24 };
+    const XMMRegister tmp[8]  = { xmm5, xmm25, xmm26, xmm27, xmm28, xmm29, xmm30, xmm31 };
+    // lane_mask[j] selects lane j; input_mask[y] selects the lanes of row y
+    // that take input, 1 <= y <= 3
+    const KRegister lane_mask[5]  = { knoreg, k1, k2, k3, k4 };
+    const KRegister input_mask[4] = { knoreg, k5, k6, k7 };
+
+    Label L_sha3_loop, L_rounds_loop, L_sha3_384, L_sha3_512, L_row3_mask, L_masks_done;
+
+    __ enter();
+#ifdef _WIN64
+    __ movl(limit, limit_mem);
+#endif
+
+    __ lea(consts, ExternalAddress((address) keccak_consts));
+    for (int y = 0; y < 5; y++) {
+      __ evmovdquq(rot[y], Address(consts, rot_offset + y * 64), Assembler::AVX_512bit);
+    }
+    for (int k = 1; k < 5; k++) {
+      __ evmovdquq(perm[k], Address(consts, perm_offset + (k - 1) * 64), Assembler::AVX_512bit);
+    }
+    for (int j = 1; j < 5; j++) {
+      __ movl(round, 1 << j);
+      __ kmovwl(lane_mask[j], round);
+    }
+
+    // load state
+    __ movl(round, 0x1F);
+    __ kmovwl(k5, round);
+    for (int y = 0; y < 5; y++) {
+      __ evmovdquq(row[y], k5, Address(state, y * 40), /*merge*/ false, Assembler::AVX_512bit);
+    }
+
+    // A block is 18 (SHA3-224), 17 (SHA3-256), 13 (SHA3-384) or 9 (SHA3-512)
+    // lanes: row 0 always takes input and row 4 never does.
+    __ cmpl(digest_length, 48);
+    __ jcc(Assembler::equal, L_sha3_384);
+    __ cmpl(digest_length, 64);
+    __ jcc(Assembler::equal, L_sha3_512);
+    __ kmovwl(k6, round);
+    __ movl(round, 0x07);
+    __ cmpl(digest_length, 28);
+    __ jcc(Assembler::equal, L_row3_mask);
+    __ movl(round, 0x03);
+    __ BIND(L_row3_mask);
+    __ kmovwl(k7, round);
+    __ jmp(L_masks_done);
+
+    __ BIND(L_sha3_384);
+    __ movl(round, 0x07);
+    __ kmovwl(k6, round);
+    __ xorl(round, round);
+    __ kmovwl(k7, round);
+    __ jmp(L_masks_done);
+
+    __ BIND(L_sha3_512);
+    __ movl(round, 0x0F);
+    __ kmovwl(k5, round);
+    __ xorl(round, round);
+    __ kmovwl(k6, round);
+    __ kmovwl(k7, round);
+
+    __ BIND(L_masks_done);
+
+    __ BIND(L_sha3_loop);
+
+    // absorb the block; every block is at least 64 bytes long, and the input
+    // in lanes 5-7 of row 0 only lands in unused lanes
+    __ evmovdquq(tmp[0], Address(buf, 0), Assembler::AVX_512bit);
+    __ evpxorq(row[0], row[0], tmp[0], Assembler::AVX_512bit);
+    for (int y = 1; y < 4; y++) {
+      __ evmovdquq(tmp[y], input_mask[y], Address(buf, y * 40), /*merge*/ false, Assembler::AVX_512bit);
+      __ evpxorq(row[y], row[y], tmp[y], Assembler::AVX_512bit);
+    }
+
+    // 24 keccak rounds
+    __ movptr(round, -24);
+    __ BIND(L_rounds_loop);
+
+    // theta
+    __ evmovdquq(tmp[0], row[0], Assembler::AVX_512bit);
+    __ vpternlogq(tmp[0], 0x96, row[1], row[2], Assembler::AVX_512bit);
+    __ vpternlogq(tmp[0], 0x96, row[3], row[4], Assembler::AVX_512bit);
+    __ vpermq(tmp[1], perm[4], tmp[0], Assembler::AVX_512bit);
+    __ vpermq(tmp[2], perm[1], tmp[0], Assembler::AVX_512bit);
+    __ evprolq(tmp[2], tmp[2], 1, Assembler::AVX_512bit);
+    for (int y = 0; y < 5; y++) {
+      __ vpternlogq(row[y], 0x96, tmp[1], tmp[2], Assembler::AVX_512bit);
+    }
+
+    // rho
+    for (int y = 0; y < 5; y++) {
+      __ evprolvq(row[y], row[y], rot[y], Assembler::AVX_512bit);
+    }
+
+    // pi: new lane (x, y) is old lane ((x + 3y) % 5, x). Collect diagonal k,
+    // whose lane j comes from row (j - k) % 5, and rotate it by k lanes so
+    // that lane x holds lane (x + k) % 5 of row x; new row y is diagonal 3y % 5.
+    for (int k = 0; k < 5; k++) {
+      __ evmovdquq(tmp[k], row[(5 - k) % 5], Assembler::AVX_512bit);
+      for (int j = 1; j < 5; j++) {
+        __ evmovdquq(tmp[k], lane_mask[j], row[(j - k + 5) % 5], /*merge*/ true, Assembler::AVX_512bit);
+      }
+    }
+    for (int y = 0; y < 5; y++) {
+      int k = (3 * y) % 5;
+      if (k == 0) {
+        __ evmovdquq(row[y], tmp[k], Assembler::AVX_512bit);
+      } else {
+        __ vpermq(row[y], perm[k], tmp[k], Assembler::AVX_512bit);
+      }
+    }
+
+    // chi: lane x ^= ~lane (x + 1) & lane (x + 2)
+    for (int y = 0; y < 5; y++) {
+      XMMRegister t1 = tmp[(2 * y) % 8];
+      XMMRegister t2 = tmp[(2 * y + 1) % 8];
+      __ vpermq(t1, perm[1], row[y], Assembler::AVX_512bit);
+      __ vpermq(t2, perm[2], row[y], Assembler::AVX_512bit);
+      __ vpternlogq(row[y], 0xD2, t1, t2, Assembler::AVX_512bit);
+    }
+
+    // iota
+    __ movq(tmp[0], Address(consts, round, Address::times_8, rc_offset + 24 * wordSize));
+    __ evpxorq(row[0], row[0], tmp[0], Assembler::AVX_512bit);
+
+    __ incrementq(round);
+    __ jcc(Assembler::notZero, L_rounds_loop);
+
+    // block_size = 200 - 2 * digest_length
+    __ movl(round, 200);
+    __ subl(round, digest_length);
+    __ subl(round, digest_length);
+    __ addptr(buf, round);
+    if (multi_block) {
+      __ addl(ofs, round);
+      __ cmpl(ofs, limit);
+      __ jcc(Assembler::lessEqual, L_sha3_loop);
+    }
+
+    // store state
+    __ movl(round, 0x1F);
+    __ kmovwl(k5, round);
+    for (int y = 0; y < 5; y++) {
+      __ evmovdquq(Address(state, y * 40), k5, row[y], /*merge*/ true, Assembler::AVX_512bit);
+    }
+    if (multi_block) {
+      __ movl(rax, ofs); // return ofs
+    }
+
+    __ vzeroupper();
+    __ leave();
+    __ ret(0);
+    return start;
+  }
+
   address ghash_polynomial512_addr() {
     __ align(CodeEntryAlignment);
     StubCodeMark mark(this, "StubRoutines", "_ghash_poly512_addr");
@@ -7763,6 +7978,10 @@ address generate_avx_ghash_processBlocks() {
       StubRoutines::_sha512_implCompress = generate_sha512_implCompress(false, "sha512_implCompress");
       StubRoutines::_sha512_implCompressMB = generate_sha512_implCompress(true, "sha512_implCompressMB");
     }
+    if (UseSHA3Intrinsics) {
+      StubRoutines::_sha3_implCompress = generate_sha3_implCompress(false, "sha3_implCompress");
+      StubRoutines::_sha3_implCompressMB = generate_sha3_implCompress(true, "sha3_implCompressMB");
+    }
 
     // Generate GHASH intrinsics code
     if (UseGHASHIntrinsics) {
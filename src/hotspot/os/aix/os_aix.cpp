@@ -1854,6 +1854,10 @@ bool os::remove_stack_guard_pages(char* addr, size_t size) {
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
+bool os::pd_collapse_large_pages(char* addr, size_t bytes) {
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
@@ -1887,7 +1891,7 @@ int os::numa_get_group_id_for_address(const void* address) {
   return 0;
 }
 
-bool os::get_page_info(char *start, page_info* info) {
+bool os::get_page_info(char *start, size_t page_size, size_t count, page_info* info) {
   return false;
 }
 
@@ -2833,6 +2837,10 @@ int os::loadavg(double values[], int nelem) {
   }
 }
 
+int os::memory_pressure(double* pressure) {
+  return -1;
+}
+
 void os::pause() {
   char filename[MAX_PATH];
   if (PauseAtStartupFile && PauseAtStartupFile[0]) {
@@ -281,3 +281,15 @@ jlong CgroupV1Subsystem::pids_current() {
                      "Current number of tasks is: " JLONG_FORMAT, JLONG_FORMAT, pids_current);
   return pids_current;
 }
+
+/* memory_pressure
+ *
+ * Pressure stall information is only provided by the cgroup v2 interface.
+ *
+ * return:
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV1Subsystem::memory_pressure() {
+  log_trace(os, container)("Memory Pressure is not supported.");
+  return OSCONTAINER_ERROR;
+}
@@ -89,6 +89,7 @@ class CgroupV1Subsystem: public CgroupSubsystem {
 
     jlong pids_max();
     jlong pids_current();
+    double memory_pressure();
 
     const char * container_type() {
       return "cgroupv1";
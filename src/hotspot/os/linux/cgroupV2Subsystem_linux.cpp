@@ -262,3 +262,19 @@ jlong CgroupV2Subsystem::pids_current() {
                      "Current number of tasks is: " JLONG_FORMAT, JLONG_FORMAT, pids_current);
   return pids_current;
 }
+
+/* memory_pressure
+ *
+ * The share of recent time, in percent, in which some tasks in the cgroup
+ * were stalled waiting for memory. Uses the 10 second average of the "some"
+ * line of the cgroup's pressure stall information.
+ *
+ * return:
+ *    memory pressure in percent
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV2Subsystem::memory_pressure() {
+  GET_CONTAINER_INFO_LINE(double, _unified, "/memory.pressure", "some",
+                          "Memory Pressure is: %1.2f", "%s avg10=%lf", memory_pressure);
+  return memory_pressure;
+}
@@ -81,6 +81,7 @@ class CgroupV2Subsystem: public CgroupSubsystem {
     char * cpu_cpuset_memory_nodes();
     jlong pids_max();
     jlong pids_current();
+    double memory_pressure();
 
     const char * container_type() {
       return "cgroupv2";
@@ -139,3 +139,8 @@ jlong OSContainer::pids_current() {
   assert(cgroup_subsystem != NULL, "cgroup subsystem not available");
   return cgroup_subsystem->pids_current();
 }
+
+double OSContainer::memory_pressure() {
+  assert(cgroup_subsystem != NULL, "cgroup subsystem not available");
+  return cgroup_subsystem->memory_pressure();
+}
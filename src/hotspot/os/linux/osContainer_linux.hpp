@@ -64,6 +64,8 @@ class OSContainer: AllStatic {
 
   static jlong pids_max();
   static jlong pids_current();
+
+  static double memory_pressure();
 };
 
 inline bool OSContainer::is_containerized() {
@@ -2718,6 +2718,11 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE 25
+#endif
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
@@ -2752,6 +2757,21 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+bool os::pd_collapse_large_pages(char* addr, size_t bytes) {
+  if (!UseTransparentHugePages) {
+    return false;
+  }
+  const size_t lp = os::large_page_size();
+  char* start = align_up(addr, lp);
+  char* end = align_down(addr + bytes, lp);
+  if (start >= end) {
+    return true;
+  }
+  // Unlike khugepaged, MADV_COLLAPSE (Linux 6.1) does the work synchronously
+  // and independent of the system's THP defrag setting.
+  return ::madvise(start, end - start, MADV_COLLAPSE) == 0;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -2845,12 +2865,67 @@ size_t os::numa_get_leaf_groups(int *ids, size_t size) {
   return i;
 }
 
-bool os::get_page_info(char *start, page_info* info) {
-  return false;
+// The kernel does not report the size of the page backing an address, so
+// pages are assumed to be of the expected size. Pages are queried in batches
+// to limit the number of system calls.
+bool os::get_page_info(char *start, size_t page_size, size_t count, page_info* info) {
+  assert(page_size > 0, "must be");
+  const size_t batch_size = 64;
+  void* pages[batch_size];
+  int status[batch_size];
+
+  for (size_t done = 0; done < count;) {
+    size_t n = MIN2(batch_size, count - done);
+    for (size_t i = 0; i < n; i++) {
+      pages[i] = start + (done + i) * page_size;
+    }
+    if (os::Linux::numa_move_pages(0, n, pages, NULL, status, 0) == -1) {
+      return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+      page_info* page = &info[done + i];
+      if (status[i] < 0) {
+        // Not mapped yet.
+        page->size = 0;
+        page->lgrp_id = -1;
+      } else {
+        page->size = page_size;
+        page->lgrp_id = status[i];
+      }
+    }
+    done += n;
+  }
+  return true;
 }
 
+// Pages that are not mapped yet are skipped, they are placed on the right
+// node when first touched.
 char *os::scan_pages(char *start, char* end, page_info* page_expected,
                      page_info* page_found) {
+  const size_t page_size = page_expected->size;
+  assert(page_size > 0, "must be");
+  const size_t batch_size = 64;
+  void* pages[batch_size];
+  int status[batch_size];
+
+  char* p = start;
+  while (p < end) {
+    size_t count = 0;
+    for (; count < batch_size && p + count * page_size < end; count++) {
+      pages[count] = p + count * page_size;
+    }
+    if (os::Linux::numa_move_pages(0, count, pages, NULL, status, 0) == -1) {
+      return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+      if (status[i] >= 0 && status[i] != page_expected->lgrp_id) {
+        page_found->size = page_size;
+        page_found->lgrp_id = status[i];
+        return (char*)pages[i];
+      }
+    }
+    p += count * page_size;
+  }
   return end;
 }
 
@@ -5050,6 +5125,15 @@ jlong os::current_thread_cpu_time(bool user_sys_cpu_time) {
   if (user_sys_cpu_time && os::Linux::supports_fast_thread_cpu_time()) {
     return os::Linux::fast_thread_cpu_time(CLOCK_THREAD_CPUTIME_ID);
   } else {
+    if (!user_sys_cpu_time) {
+      // For the current thread the user time is available without
+      // reading and parsing /proc.
+      struct rusage usage;
+      if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+        return (jlong)usage.ru_utime.tv_sec * NANOSECS_PER_SEC +
+               (jlong)usage.ru_utime.tv_usec * (NANOSECS_PER_SEC / MICROUNITS);
+      }
+    }
     return slow_thread_cpu_time(Thread::current(), user_sys_cpu_time);
   }
 }
@@ -5074,14 +5158,17 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   char cdummy;
   int idummy;
   long ldummy;
-  FILE *fp;
+  int fd;
 
+  // This is called for every thread by periodic samplers, so read the
+  // file with plain system calls rather than a buffered stdio stream.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = fopen(proc_name, "r");
-  if (fp == NULL) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  fd = ::open(proc_name, O_RDONLY);
+  if (fd == -1) return -1;
+  statlen = ::read(fd, stat, 2047);
+  ::close(fd);
+  if (statlen <= 0) return -1;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
@@ -5132,6 +5219,30 @@ int os::loadavg(double loadavg[], int nelem) {
   return ::getloadavg(loadavg, nelem);
 }
 
+// Memory pressure support. Uses the 10 second average of the "some" line of
+// the pressure stall information (PSI), available since Linux 4.20. The
+// system-wide PSI does not reflect stalls caused by a container's memory
+// limits, so containers use the PSI of their cgroup, which only cgroup v2
+// provides.
+int os::memory_pressure(double* pressure) {
+  if (OSContainer::is_containerized()) {
+    double container_pressure = OSContainer::memory_pressure();
+    if (container_pressure < 0) {
+      return -1;
+    }
+    *pressure = container_pressure;
+    return 0;
+  }
+
+  FILE* fp = fopen("/proc/pressure/memory", "r");
+  if (fp == NULL) {
+    return -1;
+  }
+  int matched = fscanf(fp, "some avg10=%lf", pressure);
+  fclose(fp);
+  return matched == 1 ? 0 : -1;
+}
+
 void os::pause() {
   char filename[MAX_PATH];
   if (PauseAtStartupFile && PauseAtStartupFile[0]) {
@@ -3695,6 +3695,7 @@ bool os::unguard_memory(char* addr, size_t bytes) {
 }
 
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) { }
+bool os::pd_collapse_large_pages(char* addr, size_t bytes) { return false; }
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) { }
 void os::numa_make_global(char *addr, size_t bytes)    { }
 void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint)    { }
@@ -3720,7 +3721,7 @@ int os::numa_get_group_id_for_address(const void* address) {
   return 0;
 }
 
-bool os::get_page_info(char *start, page_info* info) {
+bool os::get_page_info(char *start, size_t page_size, size_t count, page_info* info) {
   return false;
 }
 
@@ -4727,6 +4728,10 @@ int os::loadavg(double loadavg[], int nelem) {
   return -1;
 }
 
+int os::memory_pressure(double* pressure) {
+  return -1;
+}
+
 
 // DontYieldALot=false by default: dutifully perform all yields as requested by JVM_Yield()
 bool os::dont_yield() {
@@ -426,7 +426,8 @@ void Compilation::install_code(int frame_size) {
     implicit_exception_table(),
     compiler(),
     has_unsafe_access(),
-    SharedRuntime::is_wide_vector(max_vector_size())
+    SharedRuntime::is_wide_vector(max_vector_size()),
+    has_scoped_access()
   );
 }
 
@@ -563,6 +564,7 @@ Compilation::Compilation(AbstractCompiler* compiler, ciEnv* env, ciMethod* metho
 , _would_profile(false)
 , _has_method_handle_invokes(false)
 , _has_reserved_stack_access(method->has_reserved_stack_access())
+, _has_scoped_access(method->is_scoped())
 , _install_code(install_code)
 , _bailout_msg(NULL)
 , _exception_info_list(NULL)
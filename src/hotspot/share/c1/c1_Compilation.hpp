@@ -80,6 +80,7 @@ class Compilation: public StackObj {
   bool               _would_profile;
   bool               _has_method_handle_invokes;  // True if this method has MethodHandle invokes.
   bool               _has_reserved_stack_access;
+  bool               _has_scoped_access;          // True if the method or an inlinee is annotated with Scoped
   bool               _install_code;
   const char*        _bailout_msg;
   ExceptionInfoList* _exception_info_list;
@@ -176,6 +177,9 @@ class Compilation: public StackObj {
   bool     has_reserved_stack_access() const { return _has_reserved_stack_access; }
   void set_has_reserved_stack_access(bool z) { _has_reserved_stack_access = z; }
 
+  bool     has_scoped_access() const         { return _has_scoped_access; }
+  void set_has_scoped_access(bool z)         { _has_scoped_access = z; }
+
   DebugInformationRecorder* debug_info_recorder() const; // = _env->debug_info();
   Dependencies* dependency_recorder() const; // = _env->dependencies()
   ImplicitExceptionTable* implicit_exception_table()     { return &_implicit_exception_table; }
@@ -3437,6 +3437,9 @@ bool GraphBuilder::try_inline(ciMethod* callee, bool holder_known, bool ignore_r
     if (callee->has_reserved_stack_access()) {
       compilation()->set_has_reserved_stack_access(true);
     }
+    if (callee->is_scoped()) {
+      compilation()->set_has_scoped_access(true);
+    }
     return true;
   }
 
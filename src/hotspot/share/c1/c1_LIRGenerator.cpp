@@ -3292,6 +3292,52 @@ void LIRGenerator::increment_event_counter_impl(CodeEmitInfo* info,
   } else {
     ShouldNotReachHere();
   }
+
+  // Sampled updates: only about every sample_rate-th event of this thread
+  // touches the shared counter. The distance to the next update is drawn from
+  // a per-thread xorshift generator, so that periodic code cannot alias with
+  // the sampling, and the update adds that many increments in advance.
+  // Notification must then fire when the counter steps over a multiple of the
+  // frequency, because stepping by more than one increment can miss the exact
+  // multiple.
+  int sample_rate = 1 << C1CounterSamplingLog;
+  bool sampled = sample_rate > 1 && step->is_constant() && is_power_of_2(step->as_jint()) &&
+                 frequency + 1 >= 2 * sample_rate;
+  LabelObj* L_skip_sample = NULL;
+  if (sampled) {
+    L_skip_sample = new LabelObj();
+    LIR_Address* countdown_addr = new LIR_Address(getThreadPointer(),
+                                                  in_bytes(JavaThread::counter_sample_countdown_offset()), T_INT);
+    LIR_Opr countdown = new_register(T_INT);
+    __ load(countdown_addr, countdown);
+    __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+    __ store(countdown, countdown_addr);
+    __ cmp(lir_cond_greater, countdown, LIR_OprFact::intConst(0));
+    __ branch(lir_cond_greater, L_skip_sample->label());
+
+    // Reseed: advance the generator and draw an odd period in
+    // [1, 2 * sample_rate - 1], which is sample_rate events on average.
+    LIR_Address* seed_addr = new LIR_Address(getThreadPointer(),
+                                             in_bytes(JavaThread::counter_sample_seed_offset()), T_INT);
+    LIR_Opr seed = new_register(T_INT);
+    LIR_Opr tmp = new_register(T_INT);
+    __ load(seed_addr, seed);
+    __ shift_left(seed, 13, tmp);
+    __ logical_xor(seed, tmp, seed);
+    __ unsigned_shift_right(seed, 17, tmp);
+    __ logical_xor(seed, tmp, seed);
+    __ shift_left(seed, 5, tmp);
+    __ logical_xor(seed, tmp, seed);
+    __ store(seed, seed_addr);
+    LIR_Opr period = new_register(T_INT);
+    __ logical_and(seed, load_immediate(2 * sample_rate - 1, T_INT), period);
+    __ logical_or(period, load_immediate(1, T_INT), period);
+    __ store(period, countdown_addr);
+    LIR_Opr scaled_step = new_register(T_INT);
+    __ shift_left(period, log2i_exact(step->as_jint()), scaled_step);
+    step = scaled_step;
+  }
+
   LIR_Address* counter = new LIR_Address(counter_holder, offset, T_INT);
   LIR_Opr result = new_register(T_INT);
   __ load(counter, result);
@@ -3302,7 +3348,12 @@ void LIRGenerator::increment_event_counter_impl(CodeEmitInfo* info,
     // The bci for info can point to cmp for if's we want the if bci
     CodeStub* overflow = new CounterOverflowStub(info, bci, meth);
     int freq = frequency << InvocationCounter::count_shift;
-    if (freq == 0) {
+    if (sampled) {
+      LIR_Opr mask = load_immediate(freq, T_INT);
+      __ logical_and(result, mask, result);
+      __ cmp(lir_cond_less, result, step);
+      __ branch(lir_cond_less, overflow);
+    } else if (freq == 0) {
       if (!step->is_constant()) {
         __ cmp(lir_cond_notEqual, step, LIR_OprFact::intConst(0));
         __ branch(lir_cond_notEqual, overflow);
@@ -3322,6 +3373,9 @@ void LIRGenerator::increment_event_counter_impl(CodeEmitInfo* info,
     }
     __ branch_destination(overflow->continuation());
   }
+  if (sampled) {
+    __ branch_destination(L_skip_sample->label());
+  }
 }
 
 void LIRGenerator::do_RuntimeCall(RuntimeCall* x) {
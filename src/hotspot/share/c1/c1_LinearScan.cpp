@@ -86,6 +86,7 @@ LinearScan::LinearScan(IR* ir, LIRGenerator* gen, FrameMap* frame_map)
  , _new_intervals_from_allocation(NULL)
  , _sorted_intervals(NULL)
  , _needs_full_resort(false)
+ , _fast_split(LinearScanFastSplitWhenProfiling && ir->compilation()->is_profiling())
  , _lir_ops(0)     // initialized later with correct length
  , _block_of_op(0) // initialized later with correct length
  , _has_info(0)
@@ -5159,6 +5160,11 @@ int LinearScanWalker::find_optimal_split_pos(Interval* it, int min_split_pos, in
       TRACE_LINEAR_SCAN(4, tty->print_cr("      cannot move split pos to block boundary because min_pos and max_pos are in same block"));
       optimal_split_pos = max_split_pos;
 
+    } else if (allocator()->fast_split()) {
+      // profiled code is short-lived, so do not spend time on the block search
+      TRACE_LINEAR_SCAN(4, tty->print_cr("      fast splitting, so splitting at max_split_pos"));
+      optimal_split_pos = max_split_pos;
+
     } else if (it->has_hole_between(max_split_pos - 1, max_split_pos) && !allocator()->is_block_begin(max_split_pos)) {
       // Do not move split position if the interval has a hole before max_split_pos.
       // Intervals resulting from Phi-Functions have more than one definition (marked
@@ -139,6 +139,7 @@ class LinearScan : public CompilationResourceObj {
   IntervalList*             _new_intervals_from_allocation; // list with all intervals created during allocation when an existing interval is split
   IntervalArray*            _sorted_intervals;  // intervals sorted by Interval::from()
   bool                      _needs_full_resort; // set to true if an Interval::from() is changed and _sorted_intervals must be resorted
+  bool                      _fast_split;        // true if split positions are not optimized (see LinearScanFastSplitWhenProfiling)
 
   LIR_OpArray               _lir_ops;           // mapping from LIR_Op id to LIR_Op node
   BlockBeginArray           _block_of_op;       // mapping from LIR_Op id to the BlockBegin containing this instruction
@@ -171,6 +172,7 @@ class LinearScan : public CompilationResourceObj {
   BlockBegin*   block_at(int idx) const          { assert(_cached_blocks.at(idx) == ir()->linear_scan_order()->at(idx), "invalid cached block list");   return _cached_blocks.at(idx); }
 
   int           num_virtual_regs() const         { return _num_virtual_regs; }
+  bool          fast_split() const               { return _fast_split; }
   // size of live_in and live_out sets of BasicBlocks (BitMap needs rounded size for iteration)
   int           live_set_size() const            { return align_up(_num_virtual_regs, BitsPerWord); }
   bool          has_fpu_registers() const        { return _has_fpu_registers; }
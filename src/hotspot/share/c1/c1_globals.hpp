@@ -222,6 +222,11 @@
   develop(bool, CountLinearScan, false,                                     \
           "collect statistic counters during LinearScan")                   \
                                                                             \
+  product(bool, LinearScanFastSplitWhenProfiling, false, EXPERIMENTAL,      \
+          "In profiled (tier 2 and 3) compilations, split intervals as "    \
+          "late as possible instead of searching for the block boundary "   \
+          "with the lowest loop depth")                                     \
+                                                                            \
   /* C1 variable */                                                         \
                                                                             \
   develop(bool, C1Breakpoint, false,                                        \
@@ -316,6 +321,12 @@
   product(bool, C1OptimizeVirtualCallProfiling, true,                       \
           "Use CHA and exact type results at call sites when updating MDOs")\
                                                                             \
+  product(intx, C1CounterSamplingLog, 0, EXPERIMENTAL,                      \
+          "Profiled code updates invocation and backedge counters only "    \
+          "on about every 2^n-th event per thread, at pseudo-random "       \
+          "intervals, by the length of the interval each time")             \
+          range(0, 10)                                                      \
+                                                                            \
   product(bool, C1UpdateMethodData, true,                                   \
           "Update MethodData*s in Tier1-generated code")                    \
                                                                             \
@@ -32,17 +32,22 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/abstractInterpreter.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/align.hpp"
@@ -110,9 +115,10 @@ class RelocateEmbeddedPointers : public BitMapClosure {
   ArchiveBuilder* _builder;
   address _dumped_obj;
   BitMap::idx_t _start_idx;
+  bool _parallel;
 public:
-  RelocateEmbeddedPointers(ArchiveBuilder* builder, address dumped_obj, BitMap::idx_t start_idx) :
-    _builder(builder), _dumped_obj(dumped_obj), _start_idx(start_idx) {}
+  RelocateEmbeddedPointers(ArchiveBuilder* builder, address dumped_obj, BitMap::idx_t start_idx, bool parallel) :
+    _builder(builder), _dumped_obj(dumped_obj), _start_idx(start_idx), _parallel(parallel) {}
 
   bool do_bit(BitMap::idx_t bit_offset) {
     size_t field_offset = size_t(bit_offset - _start_idx) * sizeof(address);
@@ -124,18 +130,22 @@ public:
     log_trace(cds)("Ref: [" PTR_FORMAT "] -> " PTR_FORMAT " => " PTR_FORMAT,
                    p2i(ptr_loc), p2i(old_p), p2i(new_p));
 
-    ArchivePtrMarker::set_and_mark_pointer(ptr_loc, new_p);
+    if (_parallel) {
+      ArchivePtrMarker::set_and_par_mark_pointer(ptr_loc, new_p);
+    } else {
+      ArchivePtrMarker::set_and_mark_pointer(ptr_loc, new_p);
+    }
     return true; // keep iterating the bitmap
   }
 };
 
-void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder) {
+void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder, bool parallel) {
   SourceObjInfo* src_info = objs()->at(i);
   assert(src_info->should_copy(), "must be");
   BitMap::idx_t start = BitMap::idx_t(src_info->ptrmap_start()); // inclusive
   BitMap::idx_t end = BitMap::idx_t(src_info->ptrmap_end());     // exclusive
 
-  RelocateEmbeddedPointers relocator(builder, src_info->dumped_addr(), start);
+  RelocateEmbeddedPointers relocator(builder, src_info->dumped_addr(), start, parallel);
   _ptrmap.iterate(&relocator, start, end);
 }
 
@@ -647,9 +657,41 @@ address ArchiveBuilder::get_dumped_addr(address src_obj) const {
   return p->dumped_addr();
 }
 
+// Relocates the pointers of the copied objects in chunks claimed by the
+// safepoint workers. Each object is only written by the worker that claimed
+// it; the shared pointer bitmap is marked atomically.
+class RelocateEmbeddedPointersTask : public WorkerTask {
+  static const int ChunkSize = 256;
+  ArchiveBuilder* _builder;
+  ArchiveBuilder::SourceObjList* _src_objs;
+  volatile int _next;
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, ArchiveBuilder::SourceObjList* src_objs) :
+    WorkerTask("CDS Relocate Embedded Pointers"), _builder(builder), _src_objs(src_objs), _next(0) {}
+
+  void work(uint worker_id) {
+    const int length = _src_objs->objs()->length();
+    for (int start = Atomic::fetch_and_add(&_next, ChunkSize);
+         start < length;
+         start = Atomic::fetch_and_add(&_next, ChunkSize)) {
+      int end = MIN2(start + ChunkSize, length);
+      for (int i = start; i < end; i++) {
+        _src_objs->relocate(i, _builder, true /* parallel */);
+      }
+    }
+  }
+};
+
 void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
+  WorkerThreads* workers = SafepointSynchronize::is_at_safepoint() ? Universe::heap()->safepoint_workers() : NULL;
+  if (workers != NULL && workers->active_workers() > 1) {
+    ArchivePtrMarker::expand_to_committed();
+    RelocateEmbeddedPointersTask task(this, src_objs);
+    workers->run_task(&task);
+  } else {
+    for (int i = 0; i < src_objs->objs()->length(); i++) {
+      src_objs->relocate(i, this);
+    }
   }
 }
 
@@ -171,7 +171,7 @@ private:
 
     void append(MetaspaceClosure::Ref* enclosing_ref, SourceObjInfo* src_info);
     void remember_embedded_pointer(SourceObjInfo* pointing_obj, MetaspaceClosure::Ref* ref);
-    void relocate(int i, ArchiveBuilder* builder);
+    void relocate(int i, ArchiveBuilder* builder, bool parallel = false);
 
     // convenience accessor
     SourceObjInfo* at(int i) const { return objs()->at(i); }
@@ -186,6 +186,7 @@ private:
   };
 
   class CDSMapLogger;
+  friend class RelocateEmbeddedPointersTask;
 
   static const int INITIAL_TABLE_SIZE = 15889;
   static const int MAX_TABLE_SIZE     = 1000000;
@@ -88,6 +88,32 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
   }
 }
 
+void ArchivePtrMarker::expand_to_committed() {
+  assert(_ptrmap != NULL, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  size_t size = ptr_end() - ptr_base();
+  if (_ptrmap->size() < size) {
+    _ptrmap->resize(size);
+  }
+}
+
+void ArchivePtrMarker::par_mark_pointer(address* ptr_loc) {
+  assert(_ptrmap != NULL, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+
+  if (ptr_base() <= ptr_loc && ptr_loc < ptr_end()) {
+    address value = *ptr_loc;
+    assert(value != (address)ptr_base(), "don't point to the bottom of the archive");
+
+    if (value != NULL) {
+      assert(uintx(ptr_loc) % sizeof(intptr_t) == 0, "pointers must be stored in aligned addresses");
+      size_t idx = ptr_loc - ptr_base();
+      assert(idx < _ptrmap->size(), "must have called expand_to_committed()");
+      _ptrmap->par_set_bit(idx);
+    }
+  }
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != NULL, "not initialized");
   assert(!_compacted, "cannot clear anymore");
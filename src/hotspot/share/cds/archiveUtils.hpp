@@ -54,6 +54,11 @@ public:
   static void initialize(CHeapBitMap* ptrmap, VirtualSpace* vs);
   static void mark_pointer(address* ptr_loc);
   static void clear_pointer(address* ptr_loc);
+
+  // Grow the bitmap to cover all of the committed space. After this,
+  // par_mark_pointer() can be used by several threads at once.
+  static void expand_to_committed();
+  static void par_mark_pointer(address* ptr_loc);
   static void compact(address relocatable_base, address relocatable_end);
   static void compact(size_t max_non_null_offset);
 
@@ -68,6 +73,12 @@ public:
     mark_pointer(ptr_loc);
   }
 
+  template <typename T>
+  static void set_and_par_mark_pointer(T* ptr_loc, T ptr_value) {
+    *ptr_loc = ptr_value;
+    par_mark_pointer((address*)ptr_loc);
+  }
+
   static CHeapBitMap* ptrmap() {
     return _ptrmap;
   }
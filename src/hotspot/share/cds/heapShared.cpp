@@ -305,6 +305,7 @@ oop HeapShared::archive_object(oop obj) {
 
     ArchivedObjectCache* cache = archived_object_cache();
     cache->put(obj, archived_oop);
+    cache->maybe_grow();
     if (log_is_enabled(Debug, cds, heap)) {
       ResourceMark rm;
       log_debug(cds, heap)("Archived heap object " PTR_FORMAT " ==> " PTR_FORMAT " : %s",
@@ -1317,7 +1318,7 @@ void HeapShared::init_subgraph_entry_fields(TRAPS) {
 
 void HeapShared::init_for_dumping(TRAPS) {
   if (HeapShared::can_write()) {
-    _dumped_interned_strings = new (ResourceObj::C_HEAP, mtClass)DumpedInternedStrings();
+    _dumped_interned_strings = new (ResourceObj::C_HEAP, mtClass)DumpedInternedStrings(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE);
     init_subgraph_entry_fields(CHECK);
   }
 }
@@ -1385,6 +1386,9 @@ void HeapShared::add_to_dumped_interned_strings(oop string) {
   assert_at_safepoint(); // DumpedInternedStrings uses raw oops
   bool created;
   _dumped_interned_strings->put_if_absent(string, true, &created);
+  if (created) {
+    _dumped_interned_strings->maybe_grow();
+  }
 }
 
 // At dump-time, find the location of all the non-null oop pointers in an archived heap
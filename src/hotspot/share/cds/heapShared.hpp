@@ -38,6 +38,7 @@
 #include "oops/typeArrayKlass.hpp"
 #include "utilities/bitMap.hpp"
 #include "utilities/growableArray.hpp"
+#include "utilities/resizeableResourceHash.hpp"
 #include "utilities/resourceHash.hpp"
 
 #if INCLUDE_CDS_JAVA_HEAP
@@ -224,8 +225,12 @@ private:
     return (_loaded_heap_bottom <= o && o < _loaded_heap_top);
   }
 
-  typedef ResourceHashtable<oop, oop,
-      15889, // prime number
+  // The number of archived objects grows with the classes and strings being
+  // dumped, so let the tables grow instead of letting their chains get long.
+  static const int INITIAL_TABLE_SIZE = 15889; // prime number
+  static const int MAX_TABLE_SIZE     = 1000000;
+
+  typedef ResizeableResourceHashtable<oop, oop,
       ResourceObj::C_HEAP,
       mtClassShared,
       HeapShared::oop_hash> ArchivedObjectCache;
@@ -358,7 +363,7 @@ private:
   static void reset_archived_object_states(TRAPS);
   static void create_archived_object_cache() {
     _archived_object_cache =
-      new (ResourceObj::C_HEAP, mtClass)ArchivedObjectCache();
+      new (ResourceObj::C_HEAP, mtClass)ArchivedObjectCache(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE);
   }
   static void destroy_archived_object_cache() {
     delete _archived_object_cache;
@@ -464,12 +469,18 @@ private:
 
 #if INCLUDE_CDS_JAVA_HEAP
 class DumpedInternedStrings :
-  public ResourceHashtable<oop, bool,
-                           15889, // prime number
+  public ResizeableResourceHashtable<oop, bool,
                            ResourceObj::C_HEAP,
                            mtClassShared,
                            HeapShared::string_oop_hash>
-{};
+{
+public:
+  DumpedInternedStrings(unsigned size, unsigned max_size) :
+    ResizeableResourceHashtable<oop, bool,
+                                ResourceObj::C_HEAP,
+                                mtClassShared,
+                                HeapShared::string_oop_hash>(size, max_size) {}
+};
 #endif
 
 #endif // SHARE_CDS_HEAPSHARED_HPP
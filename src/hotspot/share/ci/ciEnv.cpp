@@ -1030,6 +1030,7 @@ void ciEnv::register_method(ciMethod* target,
                             AbstractCompiler* compiler,
                             bool has_unsafe_access,
                             bool has_wide_vectors,
+                            bool has_scoped_access,
                             RTMState  rtm_state,
                             const GrowableArrayView<RuntimeStub*>& native_invokers) {
   VM_ENTRY_MARK;
@@ -1129,6 +1130,7 @@ void ciEnv::register_method(ciMethod* target,
     if (nm != NULL) {
       nm->set_has_unsafe_access(has_unsafe_access);
       nm->set_has_wide_vectors(has_wide_vectors);
+      nm->set_has_scoped_access(has_scoped_access);
 #if INCLUDE_RTM_OPT
       nm->set_rtm_state(rtm_state);
 #endif
@@ -91,6 +91,7 @@ ciMethod::ciMethod(const methodHandle& h_m, ciInstanceKlass* holder) :
   _is_c2_compilable   = !h_m->is_not_c2_compilable();
   _can_be_parsed      = true;
   _has_reserved_stack_access = h_m->has_reserved_stack_access();
+  _is_scoped          = h_m->is_scoped();
   _is_overpass        = h_m->is_overpass();
   // Lazy fields, filled in on demand.  Require allocation.
   _code               = NULL;
@@ -176,6 +177,7 @@ ciMethod::ciMethod(ciInstanceKlass* holder,
   _intrinsic_id(           vmIntrinsics::_none),
   _instructions_size(-1),
   _can_be_statically_bound(false),
+  _is_scoped(false),
   _liveness(               NULL)
 #if defined(COMPILER2)
   ,
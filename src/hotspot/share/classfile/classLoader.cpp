@@ -107,6 +107,7 @@ static JImageOpen_t                    JImageOpen             = NULL;
 static JImageClose_t                   JImageClose            = NULL;
 static JImageFindResource_t            JImageFindResource     = NULL;
 static JImageGetResource_t             JImageGetResource      = NULL;
+static JImageGetResourceAddress_t      JImageGetResourceAddress = NULL;
 
 // JimageFile pointer, or null if exploded JDK build.
 static JImageFile*                     JImage_file            = NULL;
@@ -414,9 +415,14 @@ ClassFileStream* ClassPathImageEntry::open_stream_for_loader(JavaThread* current
     if (UsePerfData) {
       ClassLoader::perf_sys_classfile_bytes_read()->inc(size);
     }
-    char* data = NEW_RESOURCE_ARRAY(char, size);
-    (*JImageGetResource)(jimage_non_null(), location, data, size);
-    // Resource allocated
+    // Parse uncompressed classes in place from the mapped image, otherwise
+    // read or expand them into a resource allocated buffer.
+    const char* data = (*JImageGetResourceAddress)(jimage_non_null(), location);
+    if (data == NULL) {
+      char* buffer = NEW_RESOURCE_ARRAY(char, size);
+      (*JImageGetResource)(jimage_non_null(), location, buffer, size);
+      data = buffer;
+    }
     assert(this == (ClassPathImageEntry*)ClassLoader::get_jrt_entry(), "must be");
     return new ClassFileStream((u1*)data,
                                (int)size,
@@ -968,6 +974,7 @@ void ClassLoader::load_jimage_library() {
   JImageClose = CAST_TO_FN_PTR(JImageClose_t, dll_lookup(handle, "JIMAGE_Close", path));
   JImageFindResource = CAST_TO_FN_PTR(JImageFindResource_t, dll_lookup(handle, "JIMAGE_FindResource", path));
   JImageGetResource = CAST_TO_FN_PTR(JImageGetResource_t, dll_lookup(handle, "JIMAGE_GetResource", path));
+  JImageGetResourceAddress = CAST_TO_FN_PTR(JImageGetResourceAddress_t, dll_lookup(handle, "JIMAGE_GetResourceAddress", path));
 }
 
 int ClassLoader::crc32(int crc, const char* buf, int len) {
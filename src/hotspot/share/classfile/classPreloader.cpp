@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classPreloader.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "utilities/ostream.hpp"
+
+GrowableArray<Symbol*>* ClassPreloader::_class_names = NULL;
+volatile int ClassPreloader::_next = 0;
+volatile int ClassPreloader::_preloaded = 0;
+volatile uint ClassPreloader::_active_threads = 0;
+
+bool ClassPreloader::read_class_list(const char* file) {
+  // Use os::open() because neither fopen() nor os::fopen()
+  // can handle long path name on Windows.
+  int fd = os::open(file, O_RDONLY, S_IREAD);
+  FILE* fp = (fd != -1) ? os::open(fd, "r") : NULL;
+  if (fp == NULL) {
+    char errmsg[JVM_MAXPATHLEN];
+    os::lasterror(errmsg, JVM_MAXPATHLEN);
+    log_warning(class, load)("Cannot open class preload list %s: %s", file, errmsg);
+    return false;
+  }
+
+  _class_names = new (ResourceObj::C_HEAP, mtClass) GrowableArray<Symbol*>(1000, mtClass);
+  char line[1024];
+  bool skip_rest = false;
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    size_t len = strlen(line);
+    bool complete = (len > 0 && line[len - 1] == '\n') || feof(fp);
+    bool skip = skip_rest;
+    skip_rest = !complete;
+    // Skip comments, @-tagged lines (lambda proxies and the like), and the
+    // tails of lines that are too long to hold a class name.
+    if (skip || line[0] == '#' || line[0] == '@') {
+      continue;
+    }
+    // The class name is the first token; options like "id:" follow it.
+    size_t name_len = strcspn(line, " \t\r\n\f");
+    if (name_len == 0 || (!complete && name_len == len)) {
+      continue;
+    }
+    _class_names->append(SymbolTable::new_symbol(line, (int)name_len));
+  }
+  fclose(fp);
+  return true;
+}
+
+void ClassPreloader::preload_class(Symbol* name, Handle loader, TRAPS) {
+  Klass* k = SystemDictionary::resolve_or_null(name, loader, Handle(), THREAD);
+  if (!HAS_PENDING_EXCEPTION && k != NULL && k->is_instance_klass()) {
+    // Linking verifies the class and rewrites its bytecodes.
+    InstanceKlass::cast(k)->link_class(THREAD);
+  }
+  if (HAS_PENDING_EXCEPTION) {
+    if (log_is_enabled(Debug, class, load)) {
+      ResourceMark rm(THREAD);
+      log_debug(class, load)("Failed to preload %s: %s", name->as_C_string(),
+                             PENDING_EXCEPTION->klass()->external_name());
+    }
+    CLEAR_PENDING_EXCEPTION;
+  } else if (k != NULL) {
+    Atomic::inc(&_preloaded);
+  }
+}
+
+void ClassPreloader::preload_thread_entry(JavaThread* thread, TRAPS) {
+  Handle loader(THREAD, SystemDictionary::java_system_loader());
+  const int length = _class_names->length();
+  for (int i = Atomic::fetch_and_add(&_next, 1); i < length; i = Atomic::fetch_and_add(&_next, 1)) {
+    HandleMark hm(THREAD);
+    // Each name is taken by one thread only; release the reference that
+    // read_class_list() created once the class has been loaded.
+    TempNewSymbol name = _class_names->at(i);
+    preload_class(name, loader, THREAD);
+  }
+  if (Atomic::sub(&_active_threads, 1u) == 0) {
+    log_info(class, load)("Preloaded %d of %d classes from %s",
+                          Atomic::load(&_preloaded), length, PreloadClassListFile);
+  }
+}
+
+void ClassPreloader::initialize(TRAPS) {
+  if (PreloadClassListFile == NULL || !read_class_list(PreloadClassListFile)) {
+    return;
+  }
+  if (_class_names->is_empty()) {
+    return;
+  }
+
+  uint threads = MIN2(PreloadClassThreads, (uint)_class_names->length());
+  _active_threads = threads;
+  for (uint i = 0; i < threads; i++) {
+    char name[32];
+    jio_snprintf(name, sizeof(name), "Class Preloader %u", i);
+    Handle thread_oop = JavaThread::create_system_thread_object(name, false /* not visible */, CHECK);
+
+    JavaThread* thread = new JavaThread(&preload_thread_entry);
+    JavaThread::vm_exit_on_osthread_failure(thread);
+
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  }
+}
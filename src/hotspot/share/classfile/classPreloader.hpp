@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_CLASSPRELOADER_HPP
+#define SHARE_CLASSFILE_CLASSPRELOADER_HPP
+
+#include "memory/allStatic.hpp"
+#include "runtime/handles.hpp"
+#include "utilities/exceptions.hpp"
+#include "utilities/growableArray.hpp"
+
+class JavaThread;
+class Symbol;
+
+// Loads and links the classes named in PreloadClassListFile through the
+// system class loader on a few background threads during startup, so that
+// parsing and verification are done by the time the application asks for
+// them. Classes are not initialized. The list uses the classlist format
+// written by DumpLoadedClassList; only the class name on each line is used.
+//
+// Loading is best effort: a class that cannot be loaded or linked is
+// skipped, and the application thread that later needs it gets the error.
+class ClassPreloader : AllStatic {
+ private:
+  static GrowableArray<Symbol*>* _class_names;
+  static volatile int _next;
+  static volatile int _preloaded;
+  static volatile uint _active_threads;
+
+  static bool read_class_list(const char* file);
+  static void preload_class(Symbol* name, Handle loader, TRAPS);
+  static void preload_thread_entry(JavaThread* thread, TRAPS);
+
+ public:
+  // Called in the live phase, after the system class loader has been set up.
+  static void initialize(TRAPS);
+};
+
+#endif // SHARE_CLASSFILE_CLASSPRELOADER_HPP
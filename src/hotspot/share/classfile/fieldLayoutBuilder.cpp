@@ -506,6 +506,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _fields(fields),
   _info(info),
   _root_group(NULL),
+  _hot_group(NULL),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(NULL),
   _layout(NULL),
@@ -539,6 +540,31 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  _hot_group = new FieldGroup();
+}
+
+// Returns true if the field of the class being laid out is listed in HotFields.
+bool FieldLayoutBuilder::is_hot_field(const Symbol* field_name) const {
+  const char* p = HotFields;
+  if (p == NULL) {
+    return false;
+  }
+  const char* const separators = ", \t\n";
+  while (*p != '\0') {
+    p += strspn(p, separators);
+    const size_t len = strcspn(p, separators);
+    if (len == 0) {
+      break;
+    }
+    const char* dot = (const char*)memchr(p, '.', len);
+    if (dot != NULL &&
+        _classname->equals(p, (int)(dot - p)) &&
+        field_name->equals(dot + 1, (int)(len - (dot - p) - 1))) {
+      return true;
+    }
+    p += len;
+  }
+  return false;
 }
 
 // Field sorting for regular classes:
@@ -561,6 +587,8 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (is_hot_field(fs.name())) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -587,6 +615,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
         fatal("Something wrong?");
     }
   }
+  _hot_group->sort_by_size();
   _root_group->sort_by_size();
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
@@ -620,6 +649,10 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  // Hot fields are allocated first, so that they get the lowest available
+  // offsets and share cache lines with the object header.
+  _layout->add(_hot_group->primitive_fields());
+  _layout->add(_hot_group->oop_fields());
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -644,6 +677,15 @@ void FieldLayoutBuilder::compute_regular_layout() {
   epilogue();
 }
 
+void FieldLayoutBuilder::add_oop_maps(FieldGroup* group, OopMapBlocksBuilder* oop_maps) const {
+  if (group->oop_fields() != NULL) {
+    for (int i = 0; i < group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = group->oop_fields()->at(i);
+      oop_maps->add(b->offset(), 1);
+    }
+  }
+}
+
 void FieldLayoutBuilder::epilogue() {
   // Computing oopmaps
   int super_oop_map_count = (_super_klass == NULL) ? 0 :_super_klass->nonstatic_oop_map_count();
@@ -656,12 +698,8 @@ void FieldLayoutBuilder::epilogue() {
     _super_klass->nonstatic_oop_map_count());
   }
 
-  if (_root_group->oop_fields() != NULL) {
-    for (int i = 0; i < _root_group->oop_fields()->length(); i++) {
-      LayoutRawBlock* b = _root_group->oop_fields()->at(i);
-      nonstatic_oop_maps->add(b->offset(), 1);
-    }
-  }
+  add_oop_maps(_hot_group, nonstatic_oop_maps);
+  add_oop_maps(_root_group, nonstatic_oop_maps);
 
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
@@ -205,8 +205,15 @@ class java_lang_String : AllStatic {
   // hash P(31) from Kernighan & Ritchie
   //
   // For this reason, THIS ALGORITHM MUST MATCH String.hashCode().
+  // The loops below compute h = 31*h + c four characters at a time, using
+  // 31^2 = 961, 31^3 = 29791 and 31^4 = 923521, so that the multiplies do
+  // not form one long dependency chain. The result is the same modulo 2^32.
   static unsigned int hash_code(const jchar* s, int len) {
     unsigned int h = 0;
+    for (; len >= 4; len -= 4, s += 4) {
+      h = 923521*h + 29791*(unsigned int) s[0] + 961*(unsigned int) s[1] +
+          31*(unsigned int) s[2] + (unsigned int) s[3];
+    }
     while (len-- > 0) {
       h = 31*h + (unsigned int) *s;
       s++;
@@ -216,6 +223,10 @@ class java_lang_String : AllStatic {
 
   static unsigned int hash_code(const jbyte* s, int len) {
     unsigned int h = 0;
+    for (; len >= 4; len -= 4, s += 4) {
+      h = 923521*h + 29791*(((unsigned int) s[0]) & 0xFF) + 961*(((unsigned int) s[1]) & 0xFF) +
+          31*(((unsigned int) s[2]) & 0xFF) + (((unsigned int) s[3]) & 0xFF);
+    }
     while (len-- > 0) {
       h = 31*h + (((unsigned int) *s) & 0xFF);
       s++;
@@ -151,6 +151,7 @@ address CodeCache::_low_bound = 0;
 address CodeCache::_high_bound = 0;
 int CodeCache::_number_of_nmethods_with_dependencies = 0;
 ExceptionCache* volatile CodeCache::_exception_cache_purge_list = NULL;
+volatile bool CodeCache::_has_large_page_collapse_work = false;
 
 // Initialize arrays of CodeHeap subsets
 GrowableArray<CodeHeap*>* CodeCache::_heaps = new(ResourceObj::C_HEAP, mtCode) GrowableArray<CodeHeap*> (CodeBlobType::All, mtCode);
@@ -542,6 +543,12 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, bool handle_alloc_fa
       }
       return NULL;
     }
+    if (heap->collapse_pending() && !has_large_page_collapse_work()) {
+      // Collapsing may take long, so leave it to the ServiceThread
+      MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+      Atomic::release_store(&_has_large_page_collapse_work, true);
+      Service_lock->notify_all();
+    }
     if (PrintCodeCacheExtension) {
       ResourceMark rm;
       if (_nmethod_heaps->length() >= 1) {
@@ -558,6 +565,17 @@ CodeBlob* CodeCache::allocate(int size, int code_blob_type, bool handle_alloc_fa
   return cb;
 }
 
+bool CodeCache::has_large_page_collapse_work() {
+  return Atomic::load_acquire(&_has_large_page_collapse_work);
+}
+
+void CodeCache::collapse_large_pages() {
+  Atomic::release_store(&_has_large_page_collapse_work, false);
+  FOR_ALL_HEAPS(heap) {
+    (*heap)->collapse_large_pages();
+  }
+}
+
 void CodeCache::free(CodeBlob* cb) {
   assert_locked_or_safepoint(CodeCache_lock);
   CodeHeap* heap = get_code_heap(cb);
@@ -1161,15 +1179,20 @@ int CodeCache::mark_for_deoptimization(Method* dependee) {
   return number_of_marked_CodeBlobs;
 }
 
-void CodeCache::make_marked_nmethods_not_entrant() {
+// Returns the number of compiled methods that were made not entrant.
+int CodeCache::make_marked_nmethods_not_entrant() {
   assert_locked_or_safepoint(CodeCache_lock);
+  int made_not_entrant = 0;
   CompiledMethodIterator iter(CompiledMethodIterator::only_alive_and_not_unloading);
   while(iter.next()) {
     CompiledMethod* nm = iter.method();
     if (nm->is_marked_for_deoptimization()) {
-      nm->make_not_entrant();
+      if (nm->make_not_entrant()) {
+        made_not_entrant++;
+      }
     }
   }
+  return made_not_entrant;
 }
 
 // Flushes compiled methods dependent on dependee.
@@ -1259,6 +1282,9 @@ void CodeCache::report_codemem_full(int code_blob_type, bool print) {
     {
       MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
       print_summary(&s);
+      log_warning(codecache)("%s: " SIZE_FORMAT "Kb unallocated, largest free block " SIZE_FORMAT "Kb in %d free blocks",
+                             heap->name(), heap->unallocated_capacity()/K,
+                             heap->largest_free_block()/K, heap->freelist_length());
     }
     {
       ttyLocker ttyl;
@@ -1282,6 +1308,10 @@ void CodeCache::report_codemem_full(int code_blob_type, bool print) {
     event.set_methodCount(heap->nmethod_count());
     event.set_adaptorCount(heap->adapter_count());
     event.set_unallocatedCapacity(heap->unallocated_capacity());
+    {
+      MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+      event.set_largestFreeBlock(heap->largest_free_block());
+    }
     event.set_fullCount(heap->full_count());
     event.commit();
   }
@@ -97,6 +97,7 @@ class CodeCache : AllStatic {
   static uint8_t _unloading_cycle;                      // Global state for recognizing old nmethods that need to be unloaded
 
   static ExceptionCache* volatile _exception_cache_purge_list;
+  static volatile bool _has_large_page_collapse_work;        // Some CodeHeap has memory to collapse into large pages
 
   // CodeHeap management
   static void initialize_heaps();                             // Initializes the CodeHeaps
@@ -130,6 +131,10 @@ class CodeCache : AllStatic {
 
   static int code_heap_compare(CodeHeap* const &lhs, CodeHeap* const &rhs);
 
+  // Large page collapse of expanded CodeHeaps, done by the ServiceThread
+  static bool has_large_page_collapse_work();
+  static void collapse_large_pages();
+
   static void add_heap(CodeHeap* heap);
   static const GrowableArray<CodeHeap*>* heaps() { return _heaps; }
   static const GrowableArray<CodeHeap*>* compiled_heaps() { return _compiled_heaps; }
@@ -264,7 +269,7 @@ class CodeCache : AllStatic {
  public:
   static void mark_all_nmethods_for_deoptimization();
   static int  mark_for_deoptimization(Method* dependee);
-  static void make_marked_nmethods_not_entrant();
+  static int  make_marked_nmethods_not_entrant();
 
   // Flushing and deoptimization
   static void flush_dependents_on(InstanceKlass* dependee);
@@ -80,6 +80,7 @@ void CompiledMethod::init_defaults() {
   _has_unsafe_access          = 0;
   _has_method_handle_invokes  = 0;
   _has_wide_vectors           = 0;
+  _has_scoped_access          = 0;
 }
 
 bool CompiledMethod::is_method_handle_return(address return_pc) {
@@ -156,6 +156,7 @@ protected:
   unsigned int _has_unsafe_access:1;         // May fault due to unsafe access.
   unsigned int _has_method_handle_invokes:1; // Has this method MethodHandle invokes?
   unsigned int _has_wide_vectors:1;          // Preserve wide vectors at safepoints
+  unsigned int _has_scoped_access:1;         // The method or an inlinee accesses scoped memory
 
   Method*   _method;
   address _scopes_data_begin;
@@ -196,6 +197,9 @@ public:
   bool  has_wide_vectors() const                  { return _has_wide_vectors; }
   void  set_has_wide_vectors(bool z)              { _has_wide_vectors = z; }
 
+  bool  has_scoped_access() const                 { return _has_scoped_access; }
+  void  set_has_scoped_access(bool z)             { _has_scoped_access = z; }
+
   enum { not_installed = -1, // in construction, only the owner doing the construction is
                              // allowed to advance state
          in_use        = 0,  // executable nmethod
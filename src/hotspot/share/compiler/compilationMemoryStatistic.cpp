@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "compiler/abstractCompiler.hpp"
+#include "compiler/compilationMemoryStatistic.hpp"
+#include "compiler/compileTask.hpp"
+#include "compiler/compilerThread.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "utilities/ostream.hpp"
+
+struct MemStatEntry {
+  char*  _method;      // C-heap copy of the method name and signature
+  uint   _compile_id;
+  int    _comp_level;
+  size_t _peak;
+};
+
+// Sorted by _peak, largest first. Protected by CompilationMemoryStatistic_lock.
+static MemStatEntry _entries[CompilationMemoryStatistic::MaxEntries];
+static int _num_entries = 0;
+static uint64_t _num_compilations = 0;
+
+static ArenaStatCounter* current_arena_stat() {
+  Thread* t = Thread::current_or_null();
+  if (t == NULL || !t->is_Compiler_thread()) {
+    return NULL;
+  }
+  return CompilerThread::cast(t)->arena_stat();
+}
+
+void CompilationMemoryStatistic::on_start_compilation() {
+  ArenaStatCounter* counter = current_arena_stat();
+  if (counter != NULL) {
+    counter->start();
+  }
+}
+
+void CompilationMemoryStatistic::on_arena_change(ssize_t delta) {
+  ArenaStatCounter* counter = current_arena_stat();
+  if (counter != NULL) {
+    counter->account(delta);
+  }
+}
+
+static void add_entry(const char* method, uint compile_id, int comp_level, size_t peak) {
+  MutexLocker ml(CompilationMemoryStatistic_lock);
+  _num_compilations++;
+
+  const int max = CompilationMemoryStatistic::MaxEntries;
+  if (_num_entries == max && _entries[max - 1]._peak >= peak) {
+    return;
+  }
+  int pos = 0;
+  while (pos < _num_entries && _entries[pos]._peak >= peak) {
+    pos++;
+  }
+  if (_num_entries == max) {
+    os::free(_entries[max - 1]._method);
+    _num_entries--;
+  }
+  for (int i = _num_entries; i > pos; i--) {
+    _entries[i] = _entries[i - 1];
+  }
+  _entries[pos]._method = os::strdup(method, mtCompiler);
+  _entries[pos]._compile_id = compile_id;
+  _entries[pos]._comp_level = comp_level;
+  _entries[pos]._peak = peak;
+  _num_entries++;
+}
+
+void CompilationMemoryStatistic::on_end_compilation(CompileTask* task) {
+  ArenaStatCounter* counter = current_arena_stat();
+  if (counter == NULL) {
+    return;
+  }
+  size_t peak = counter->peak_since_start();
+
+  EventCompilationMemory event;
+  if (event.should_commit()) {
+    event.set_compileId(task->compile_id());
+    event.set_compiler(task->compiler()->type());
+    event.set_method(task->method());
+    event.set_peakArenaMemory(peak);
+    event.commit();
+  }
+
+  ResourceMark rm;
+  add_entry(task->method()->name_and_sig_as_C_string(), task->compile_id(),
+            task->comp_level(), peak);
+}
+
+void CompilationMemoryStatistic::print_all_by_size(outputStream* st, size_t min_size) {
+  if (!CompilerMemoryStatistics) {
+    st->print_cr("Compilation memory statistics are not enabled (-XX:+CompilerMemoryStatistics).");
+    return;
+  }
+  MutexLocker ml(CompilationMemoryStatistic_lock);
+  st->print_cr("Compilation memory statistics: " UINT64_FORMAT " compilations, largest %d:",
+               _num_compilations, _num_entries);
+  st->print_cr("%12s %8s %5s  %s", "peak (bytes)", "id", "level", "method");
+  for (int i = 0; i < _num_entries; i++) {
+    const MemStatEntry& e = _entries[i];
+    if (e._peak < min_size) {
+      break;
+    }
+    st->print_cr(SIZE_FORMAT_W(12) " %8u %5d  %s", e._peak, e._compile_id, e._comp_level, e._method);
+  }
+}
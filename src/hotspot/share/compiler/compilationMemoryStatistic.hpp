@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_COMPILATIONMEMORYSTATISTIC_HPP
+#define SHARE_COMPILER_COMPILATIONMEMORYSTATISTIC_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class CompileTask;
+class outputStream;
+
+// Arena memory used by one compiler thread. All arenas of the thread,
+// including its resource area, contribute.
+class ArenaStatCounter : public CHeapObj<mtCompiler> {
+  ssize_t _current; // Bytes currently held by the arenas of this thread
+  ssize_t _start;   // _current when the compilation started
+  ssize_t _peak;    // Highest _current since the compilation started
+
+ public:
+  ArenaStatCounter() : _current(0), _start(0), _peak(0) {}
+
+  void start() {
+    _start = _current;
+    _peak = _current;
+  }
+
+  void account(ssize_t delta) {
+    _current += delta;
+    if (_current > _peak) {
+      _peak = _current;
+    }
+  }
+
+  size_t peak_since_start() const { return (size_t)(_peak - _start); }
+};
+
+// With -XX:+CompilerMemoryStatistics, records the peak arena memory of
+// every compilation, keeps the most expensive ones for jcmd Compiler.memory
+// and posts a CompilationMemory JFR event.
+class CompilationMemoryStatistic : public AllStatic {
+ public:
+  static const int MaxEntries = 64;
+
+  static void on_start_compilation();
+  static void on_end_compilation(CompileTask* task);
+  static void on_arena_change(ssize_t delta);
+
+  // Print the recorded compilations, largest first, that used at least
+  // min_size bytes.
+  static void print_all_by_size(outputStream* st, size_t min_size);
+};
+
+#endif // SHARE_COMPILER_COMPILATIONMEMORYSTATISTIC_HPP
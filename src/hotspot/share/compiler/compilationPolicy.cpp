@@ -85,10 +85,39 @@ bool CompilationPolicy::must_be_compiled(const methodHandle& m, int comp_level)
          (UseCompiler && AlwaysCompileLoopMethods && m->has_loops() && CompileBroker::should_compile_new_jobs()); // eagerly compile loop methods
 }
 
+bool CompilationPolicy::should_compile_hot_at_dump(const methodHandle& m) {
+  if (!EagerCompileArchivedHotMethods || !m->is_hot_at_dump()) return false;
+  if (ReplayCompiles || !UseCompiler || !CompileBroker::should_compile_new_jobs()) return false;
+
+  if (m->has_compiled_code() || m->queued_for_compilation()) return false;
+  return can_be_compiled(m);
+}
+
+bool CompilationPolicy::should_compile_ahead(const methodHandle& m) {
+  if (m->has_compiled_code() || m->queued_for_compilation()) return false;
+  if (!m->is_compile_ahead()) return false;
+  if (ReplayCompiles || !UseCompiler || !CompileBroker::should_compile_new_jobs()) return false;
+
+  return can_be_compiled(m);
+}
+
 void CompilationPolicy::compile_if_required(const methodHandle& m, TRAPS) {
+  CompileTask::CompileReason reason = CompileTask::Reason_None;
   if (must_be_compiled(m)) {
     // This path is unusual, mostly used by the '-Xcomp' stress test mode.
-
+    reason = CompileTask::Reason_MustBeCompiled;
+  } else if (should_compile_hot_at_dump(m)) {
+    // Start profiling a method that was hot in the training run right away,
+    // instead of waiting for the interpreter counters to reach the thresholds.
+    reason = CompileTask::Reason_HotAtDump;
+  } else if (should_compile_ahead(m)) {
+    // The method is on a compile list (CompileCommand compileahead), typically
+    // one collected in a training run. Use idle compiler threads now instead
+    // of interpreting it until it gets hot.
+    reason = CompileTask::Reason_CompileAhead;
+  }
+
+  if (reason != CompileTask::Reason_None) {
     if (!THREAD->can_call_java() || THREAD->is_Compiler_thread()) {
       // don't force compilation, resolve was on behalf of compiler
       return;
@@ -107,7 +136,7 @@ void CompilationPolicy::compile_if_required(const methodHandle& m, TRAPS) {
     if (PrintTieredEvents) {
       print_event(COMPILE, m(), m(), InvocationEntryBci, level);
     }
-    CompileBroker::compile_method(m, InvocationEntryBci, level, methodHandle(), 0, CompileTask::Reason_MustBeCompiled, THREAD);
+    CompileBroker::compile_method(m, InvocationEntryBci, level, methodHandle(), 0, reason, THREAD);
   }
 }
 
@@ -234,6 +263,9 @@ public:
     if (CompilerOracle::has_option_value(method, CompileCommand::CompileThresholdScaling, threshold_scaling)) {
       scale *= threshold_scaling;
     }
+    if (method->is_hot_at_dump()) {
+      scale *= ArchivedHotMethodThresholdScaling;
+    }
     switch(cur_level) {
     case CompLevel_none:
     case CompLevel_limited_profile:
@@ -272,6 +304,9 @@ public:
     if (CompilerOracle::has_option_value(method, CompileCommand::CompileThresholdScaling, threshold_scaling)) {
       scale *= threshold_scaling;
     }
+    if (method->is_hot_at_dump()) {
+      scale *= ArchivedHotMethodThresholdScaling;
+    }
     switch(cur_level) {
     case CompLevel_none:
     case CompLevel_limited_profile:
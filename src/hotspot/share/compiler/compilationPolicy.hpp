@@ -236,6 +236,12 @@ class CompilationPolicy : AllStatic {
 
   // m must be compiled before executing it
   static bool must_be_compiled(const methodHandle& m, int comp_level = CompLevel_any);
+  // m was hot in the run that dumped the CDS archive and should be compiled
+  // as soon as it is linked
+  static bool should_compile_hot_at_dump(const methodHandle& m);
+  // m matches a "compileahead" CompileCommand and should be compiled when the
+  // first call to it is resolved, instead of when it gets hot
+  static bool should_compile_ahead(const methodHandle& m);
 public:
   static int min_invocations() { return Tier4MinInvocationThreshold; }
   static int c1_count() { return _c1_count; }
@@ -243,7 +249,9 @@ public:
   static int compiler_count(CompLevel comp_level);
 
   // If m must_be_compiled then request a compilation from the CompileBroker.
-  // This supports the -Xcomp option.
+  // This supports the -Xcomp option. Methods that were hot when the CDS
+  // archive was dumped are also compiled here with EagerCompileArchivedHotMethods,
+  // and so are methods that match a "compileahead" CompileCommand.
   static void compile_if_required(const methodHandle& m, TRAPS);
 
   // m is allowed to be compiled
@@ -31,6 +31,7 @@
 #include "code/codeCache.hpp"
 #include "code/codeHeapState.hpp"
 #include "code/dependencyContext.hpp"
+#include "compiler/compilationMemoryStatistic.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
@@ -359,7 +360,8 @@ void CompileQueue::add(CompileTask* task) {
   task->set_next(NULL);
   task->set_prev(NULL);
 
-  if (_last == NULL) {
+  bool was_empty = (_last == NULL);
+  if (was_empty) {
     // The compile queue is empty.
     assert(_first == NULL, "queue is empty");
     _first = task;
@@ -372,6 +374,7 @@ void CompileQueue::add(CompileTask* task) {
     _last = task;
   }
   ++_size;
+  update_perf_size();
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -384,8 +387,13 @@ void CompileQueue::add(CompileTask* task) {
     task->log_task_queued();
   }
 
-  // Notify CompilerThreads that a task is available.
-  MethodCompileQueue_lock->notify_all();
+  // Notify CompilerThreads that a task is available. Compiler threads only
+  // wait while the queue is empty, and every waiter was already notified
+  // when the queue turned non-empty, so appending to a non-empty queue need
+  // not wake the (possibly many) compiler threads sharing the lock again.
+  if (was_empty) {
+    MethodCompileQueue_lock->notify_all();
+  }
 }
 
 /**
@@ -480,6 +488,12 @@ CompileTask* CompileQueue::get() {
   return task;
 }
 
+void CompileQueue::update_perf_size() {
+  if (_perf_size != NULL) {
+    _perf_size->set_value(_size);
+  }
+}
+
 // Clean & deallocate stale compile tasks.
 // Temporarily releases MethodCompileQueue lock.
 void CompileQueue::purge_stale_tasks() {
@@ -521,6 +535,7 @@ void CompileQueue::remove(CompileTask* task) {
     _last = task->prev();
   }
   --_size;
+  update_perf_size();
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -703,6 +718,20 @@ void CompileBroker::compilation_init_phase1(JavaThread* THREAD) {
 
     EXCEPTION_MARK;
 
+    // Number of tasks waiting in each compile queue
+    if (_c1_compile_queue != NULL) {
+      PerfVariable* c1_queue_size =
+                 PerfDataManager::create_variable(SUN_CI, "c1QueueSize",
+                                                  PerfData::U_Events, CHECK);
+      _c1_compile_queue->set_perf_size(c1_queue_size);
+    }
+    if (_c2_compile_queue != NULL) {
+      PerfVariable* c2_queue_size =
+                 PerfDataManager::create_variable(SUN_CI, "c2QueueSize",
+                                                  PerfData::U_Events, CHECK);
+      _c2_compile_queue->set_perf_size(c2_queue_size);
+    }
+
     // create the jvmstat performance counters
     _perf_osr_compilation =
                  PerfDataManager::create_counter(SUN_CI, "osrTime",
@@ -1043,6 +1072,9 @@ void CompileBroker::init_compiler_sweeper_threads() {
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   julong available_memory = os::available_memory();
+  // Add fewer threads if the VM has lost processors since startup.
+  int max_c2_count = (int) os::scale_by_active_processors(_c2_count);
+  int max_c1_count = (int) os::scale_by_active_processors(_c1_count);
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
@@ -1052,7 +1084,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c2_compile_queue != NULL) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
+    int new_c2_count = MIN4(max_c2_count,
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
@@ -1106,7 +1138,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != NULL) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
+    int new_c1_count = MIN4(max_c1_count,
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
@@ -2161,6 +2193,10 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
   CompilerThread* thread = CompilerThread::current();
   ResourceMark rm(thread);
 
+  if (CompilerMemoryStatistics) {
+    CompilationMemoryStatistic::on_start_compilation();
+  }
+
   if (LogEvents) {
     _compilation_log->log_compile(thread, task);
   }
@@ -2339,6 +2375,10 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   collect_statistics(thread, time, task);
 
+  if (CompilerMemoryStatistics) {
+    CompilationMemoryStatistic::on_end_compilation(task);
+  }
+
   nmethod* nm = task->code();
   if (nm != NULL) {
     nm->maybe_print_nmethod(directive);
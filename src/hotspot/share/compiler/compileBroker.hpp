@@ -89,18 +89,22 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* _first_stale;
 
   int _size;
+  PerfVariable* _perf_size;  // exports _size, if UsePerfData
 
   void purge_stale_tasks();
+  void update_perf_size();
  public:
   CompileQueue(const char* name) {
     _name = name;
     _first = NULL;
     _last = NULL;
     _size = 0;
+    _perf_size = NULL;
     _first_stale = NULL;
   }
 
   const char*  name() const                      { return _name; }
+  void         set_perf_size(PerfVariable* v)    { _perf_size = v; update_perf_size(); }
 
   void         add(CompileTask* task);
   void         remove(CompileTask* task);
@@ -54,6 +54,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
       Reason_Whitebox,         // Whitebox API
       Reason_MustBeCompiled,   // Used for -Xcomp or AlwaysCompileLoopMethods (see CompilationPolicy::must_be_compiled())
       Reason_Bootstrap,        // JVMCI bootstrap
+      Reason_HotAtDump,        // Method was hot when the CDS archive was dumped (see Method::is_hot_at_dump())
+      Reason_CompileAhead,     // Method matches a "compileahead" CompileCommand
       Reason_Count
   };
 
@@ -66,7 +68,9 @@ class CompileTask : public CHeapObj<mtCompiler> {
       "replay",
       "whitebox",
       "must_be_compiled",
-      "bootstrap"
+      "bootstrap",
+      "hot_at_dump",
+      "compile_ahead"
     };
     return reason_names[compile_reason];
   }
@@ -127,6 +131,11 @@ class CompileTask : public CHeapObj<mtCompiler> {
       case Reason_InvocationCount:
       case Reason_Tiered:
         return !_is_blocking;
+      case Reason_HotAtDump:
+      case Reason_CompileAhead:
+        // Queued before the method has any invocations in this run, and only
+        // queued once, so they must not be dropped for being idle.
+        return false;
       default:
         return false;
     }
@@ -464,6 +464,10 @@ bool CompilerOracle::should_break_at(const methodHandle& method) {
   return check_predicate(CompileCommand::Break, method);
 }
 
+bool CompilerOracle::should_compile_ahead(const methodHandle& method) {
+  return check_predicate(CompileCommand::CompileAhead, method);
+}
+
 void CompilerOracle::tag_blackhole_if_possible(const methodHandle& method) {
   if (!check_predicate(CompileCommand::Blackhole, method)) {
     return;
@@ -53,6 +53,7 @@ class methodHandle;
   option(DontInline,  "dontinline", Bool) \
   option(Blackhole,  "blackhole", Bool) \
   option(CompileOnly, "compileonly", Bool)\
+  option(CompileAhead, "compileahead", Bool) \
   option(Exclude, "exclude", Bool) \
   option(Break, "break", Bool) \
   option(BreakAtExecute, "BreakAtExecute", Bool) \
@@ -142,6 +143,9 @@ class CompilerOracle : AllStatic {
   // Tells whether to break when compiling method
   static bool should_break_at(const methodHandle& method);
 
+  // Tells whether to compile method when the first call to it is resolved
+  static bool should_compile_ahead(const methodHandle& method);
+
   // Tells whether there are any methods to print for print_method_statistics()
   static bool should_print_methods();
 
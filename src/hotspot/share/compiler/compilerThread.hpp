@@ -29,6 +29,7 @@
 
 class BufferBlob;
 class AbstractCompiler;
+class ArenaStatCounter;
 class ciEnv;
 class CompileThread;
 class CompileLog;
@@ -54,6 +55,8 @@ class CompilerThread : public JavaThread {
   AbstractCompiler*     _compiler;
   TimeStamp             _idle_time;
 
+  ArenaStatCounter*     _arena_stat;
+
  public:
 
   static CompilerThread* current() {
@@ -80,6 +83,7 @@ class CompilerThread : public JavaThread {
 
   CompileQueue* queue()        const             { return _queue; }
   CompilerCounters* counters() const             { return _counters; }
+  ArenaStatCounter* arena_stat() const           { return _arena_stat; }
 
   // Get/set the thread's compilation environment.
   ciEnv*        env()                            { return _env; }
@@ -95,6 +95,10 @@
   product(bool, CICompilerCountPerCPU, false,                               \
           "1 compiler thread for log(N CPUs)")                              \
                                                                             \
+  product(bool, CompilerMemoryStatistics, false, DIAGNOSTIC,                \
+          "Record the peak arena memory of each compilation; see jcmd "     \
+          "Compiler.memory and the CompilationMemory JFR event")            \
+                                                                            \
   notproduct(intx, CICrashAt, -1,                                           \
           "id of compilation to trigger assert in compiler thread for "     \
           "the purpose of testing, e.g. generation of replay data")         \
@@ -138,6 +142,17 @@
           "and the value of the per-method flag.")                          \
           range(0.0, DBL_MAX)                                               \
                                                                             \
+  product(double, ArchivedHotMethodThresholdScaling, 0.1,                   \
+          "Factor applied to the compilation thresholds of CDS archived "   \
+          "methods that were compiled at the highest tier in the run "      \
+          "that dumped the archive")                                        \
+          range(0.0, 1.0)                                                   \
+                                                                            \
+  product(bool, EagerCompileArchivedHotMethods, false,                      \
+          "Compile CDS archived methods that were compiled at the highest " \
+          "tier in the run that dumped the archive as soon as they are "    \
+          "linked")                                                         \
+                                                                            \
   product(intx, Tier0InvokeNotifyFreqLog, 7,                                \
           "Interpreter (tier 0) invocation notification frequency")         \
           range(0, 30)                                                      \
@@ -274,8 +274,8 @@ public:
 
 class OldGCAllocRegion : public G1GCAllocRegion {
 public:
-  OldGCAllocRegion(G1EvacStats* stats)
-  : G1GCAllocRegion("Old GC Alloc Region", true /* bot_updates */, stats, G1HeapRegionAttr::Old) { }
+  OldGCAllocRegion(G1EvacStats* stats, uint node_index)
+  : G1GCAllocRegion("Old GC Alloc Region", true /* bot_updates */, stats, G1HeapRegionAttr::Old, node_index) { }
 
   // This specialization of release() makes sure that the last card that has
   // been allocated into has been completely filled by a dummy object.  This
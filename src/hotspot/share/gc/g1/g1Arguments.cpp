@@ -37,6 +37,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 static size_t calculate_heap_alignment(size_t space_alignment) {
   size_t card_table_alignment = CardTableRS::ct_max_alignment_constraint();
@@ -124,6 +125,19 @@ void G1Arguments::initialize_mark_stack_size() {
   log_trace(gc)("MarkStackSize: %uk  MarkStackSizeMax: %uk", (uint)(MarkStackSize / K), (uint)(MarkStackSizeMax / K));
 }
 
+void G1Arguments::initialize_hot_card_cache_size() {
+  // The default hot card cache only covers a small set of hot cards. Optionally
+  // scale it with the maximum heap size, using one entry per megabyte of heap.
+  // The size is bounded because the cache is drained during the pause.
+  if (G1ScaleHotCardCache && FLAG_IS_DEFAULT(G1ConcRSLogCacheSize) && G1ConcRSLogCacheSize > 0) {
+    const size_t max_log_cache_size = 16;
+    size_t log_cache_size = (size_t)log2i_graceful(MAX2(MaxHeapSize / M, (size_t)1));
+    log_cache_size = clamp(log_cache_size, G1ConcRSLogCacheSize, max_log_cache_size);
+    FLAG_SET_ERGO(G1ConcRSLogCacheSize, log_cache_size);
+  }
+
+  log_trace(gc)("G1ConcRSLogCacheSize: " SIZE_FORMAT, G1ConcRSLogCacheSize);
+}
 
 void G1Arguments::initialize_card_set_configuration() {
   assert(HeapRegion::LogOfHRGrainBytes != 0, "not initialized");
@@ -234,6 +248,7 @@ void G1Arguments::initialize() {
 #endif
 
   initialize_mark_stack_size();
+  initialize_hot_card_cache_size();
   initialize_verification_types();
 
   // Verify that the maximum parallelism isn't too high to eventually overflow
@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/mutex.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -174,6 +175,30 @@ void G1CardSetCoarsenStats::print_on(outputStream* out) {
                );
 }
 
+void G1CardSetContainerStats::reset() {
+  for (uint i = 0; i < NumContainerKinds; i++) {
+    _num_containers[i] = 0;
+    _num_cards[i] = 0;
+  }
+}
+
+void G1CardSetContainerStats::record(ContainerKind kind, size_t num_cards) {
+  assert(kind < NumContainerKinds, "kind %u out of bounds", kind);
+  _num_containers[kind]++;
+  _num_cards[kind] += num_cards;
+}
+
+void G1CardSetContainerStats::print_on(outputStream* out) {
+  const char* names[] = { "Inline", "AoC", "Howl", "Full",
+                          "Howl Inline", "Howl AoC", "Howl BitMap", "Howl Full" };
+  STATIC_ASSERT(ARRAY_SIZE(names) == NumContainerKinds);
+  for (uint i = 0; i < NumContainerKinds; i++) {
+    out->print_cr("    %-12s containers %zu cards %zu (avg %.1f)",
+                  names[i], _num_containers[i], _num_cards[i],
+                  _num_containers[i] == 0 ? 0.0 : (double)_num_cards[i] / _num_containers[i]);
+  }
+}
+
 class G1CardSetHashTable : public CHeapObj<mtGCCardSet> {
   using CardSetPtr = G1CardSet::CardSetPtr;
 
@@ -861,6 +886,68 @@ size_t G1CardSet::num_containers() {
   return cl._count;
 }
 
+void G1CardSet::collect_container_stats(G1CardSetContainerStats* stats) {
+  assert_at_safepoint();
+
+  class CollectContainerStats : public G1CardSetPtrIterator {
+    G1CardSetConfiguration* _config;
+    G1CardSetContainerStats* _stats;
+
+    void do_howl_bucket(CardSetPtr card_set) {
+      if (card_set == FullCardSet) {
+        _stats->record(G1CardSetContainerStats::HowlFull, _config->num_cards_in_howl_bitmap());
+        return;
+      }
+      switch (card_set_type(card_set)) {
+        case CardSetInlinePtr:
+          if (G1CardSetInlinePtr::num_cards_in(card_set) != 0) {
+            _stats->record(G1CardSetContainerStats::HowlInlinePtr, G1CardSetInlinePtr::num_cards_in(card_set));
+          }
+          break;
+        case CardSetArrayOfCards:
+          _stats->record(G1CardSetContainerStats::HowlArrayOfCards, card_set_ptr<G1CardSetArray>(card_set)->num_entries());
+          break;
+        case CardSetBitMap:
+          _stats->record(G1CardSetContainerStats::HowlBitMap, card_set_ptr<G1CardSetBitMap>(card_set)->num_bits_set());
+          break;
+        default:
+          ShouldNotReachHere();
+      }
+    }
+
+  public:
+    CollectContainerStats(G1CardSetConfiguration* config, G1CardSetContainerStats* stats) :
+      G1CardSetPtrIterator(), _config(config), _stats(stats) { }
+
+    void do_cardsetptr(uint region_idx, size_t num_occupied, CardSetPtr card_set) override {
+      if (card_set == FullCardSet) {
+        _stats->record(G1CardSetContainerStats::Full, num_occupied);
+        return;
+      }
+      switch (card_set_type(card_set)) {
+        case CardSetInlinePtr:
+          _stats->record(G1CardSetContainerStats::InlinePtr, num_occupied);
+          break;
+        case CardSetArrayOfCards:
+          _stats->record(G1CardSetContainerStats::ArrayOfCards, num_occupied);
+          break;
+        case CardSetHowl: {
+          _stats->record(G1CardSetContainerStats::Howl, num_occupied);
+          G1CardSetHowl* howl = card_set_ptr<G1CardSetHowl>(card_set);
+          for (uint i = 0; i < _config->num_buckets_in_howl(); i++) {
+            do_howl_bucket(*howl->get_card_set_addr(i));
+          }
+          break;
+        }
+        default:
+          ShouldNotReachHere();
+      }
+    }
+  } cl(_config, stats);
+
+  iterate_containers(&cl, true /* at_safepoint */);
+}
+
 G1CardSetCoarsenStats G1CardSet::coarsen_stats() {
   return _coarsen_stats;
 }
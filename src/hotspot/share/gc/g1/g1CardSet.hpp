@@ -157,6 +157,36 @@ public:
   void print_on(outputStream* out);
 };
 
+// Collects the number of card set containers of each kind and the number of
+// cards they represent. Containers within Howl containers are counted separately.
+class G1CardSetContainerStats {
+public:
+  enum ContainerKind {
+    InlinePtr,
+    ArrayOfCards,
+    Howl,
+    Full,
+    HowlInlinePtr,
+    HowlArrayOfCards,
+    HowlBitMap,
+    HowlFull,
+    NumContainerKinds
+  };
+
+private:
+  size_t _num_containers[NumContainerKinds];
+  size_t _num_cards[NumContainerKinds];
+
+public:
+  G1CardSetContainerStats() { reset(); }
+
+  void reset();
+
+  void record(ContainerKind kind, size_t num_cards);
+
+  void print_on(outputStream* out);
+};
+
 // Sparse set of card indexes comprising a remembered set on the Java heap. Card
 // size is assumed to be card table card size.
 //
@@ -326,6 +356,10 @@ public:
 
   size_t num_containers();
 
+  // Adds the kinds and occupancies of the containers of this card set to the
+  // given statistics. Must be called at a safepoint.
+  void collect_container_stats(G1CardSetContainerStats* stats);
+
   static G1CardSetCoarsenStats coarsen_stats();
   static void print_coarsen_stats(outputStream* out);
 
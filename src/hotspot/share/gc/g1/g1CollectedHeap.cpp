@@ -58,6 +58,7 @@
 #include "gc/g1/g1ParallelCleaning.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1PeriodicGCTask.hpp"
+#include "gc/g1/g1PreTouchTask.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
@@ -317,8 +318,11 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
 
   uint obj_regions = (uint) humongous_obj_size_in_regions(word_size);
 
-  // Policy: First try to allocate a humongous object in the free list.
-  HeapRegion* humongous_start = _hrm.allocate_humongous(obj_regions);
+  // Policy: First try to allocate a humongous object in the free list,
+  // preferring the node of the allocating thread.
+  uint node_index = Thread::current()->is_VM_thread() ? G1NUMA::AnyNodeIndex
+                                                      : _numa->index_of_current_thread();
+  HeapRegion* humongous_start = _hrm.allocate_humongous(obj_regions, node_index);
   if (humongous_start == NULL) {
     // Policy: We could not find enough regions for the humongous object in the
     // free list. Look through the heap to find a mix of free and uncommitted regions.
@@ -1698,9 +1702,14 @@ jint G1CollectedHeap::initialize() {
   _cm_thread = _cm->cm_thread();
 
   // Now expand into the initial heap size.
-  if (!expand(init_byte_size, _workers)) {
-    vm_shutdown_during_initialization("Failed to allocate initial heap.");
-    return JNI_ENOMEM;
+  {
+    // With G1PreTouchConcurrently the heap is pre-touched by the service
+    // thread once it is running, see G1PreTouchTask.
+    FlagSetting fs(AlwaysPreTouch, AlwaysPreTouch && !G1PreTouchConcurrently);
+    if (!expand(init_byte_size, _workers)) {
+      vm_shutdown_during_initialization("Failed to allocate initial heap.");
+      return JNI_ENOMEM;
+    }
   }
 
   // Perform any initialization actions delegated to the policy.
@@ -1726,6 +1735,10 @@ jint G1CollectedHeap::initialize() {
   _free_card_set_memory_task = new G1CardSetFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_card_set_memory_task);
 
+  if (AlwaysPreTouch && G1PreTouchConcurrently) {
+    _service_thread->register_task(new G1PreTouchTask(page_size));
+  }
+
   {
     G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
     dcqs.set_process_cards_threshold(concurrent_refine()->yellow_zone());
@@ -2394,6 +2407,15 @@ bool G1CollectedHeap::supports_concurrent_gc_breakpoints() const {
   return true;
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 bool G1CollectedHeap::is_archived_object(oop object) const {
   return object != NULL && heap_region_containing(object)->is_archive();
 }
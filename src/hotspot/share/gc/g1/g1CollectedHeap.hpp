@@ -1323,6 +1323,12 @@ public:
 
   bool is_archived_object(oop object) const override;
 
+  // JNI critical sections pin the region containing the object instead of
+  // taking the GCLocker. Evacuation leaves regions with pinned objects in place.
+  bool supports_object_pinning() const override { return true; }
+  oop pin_object(JavaThread* thread, oop obj) override;
+  void unpin_object(JavaThread* thread, oop obj) override;
+
   // The methods below are here for convenience and dispatch the
   // appropriate method depending on value of the given VerifyOption
   // parameter. The values for that parameter, and their meanings,
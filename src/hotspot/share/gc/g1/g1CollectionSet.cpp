@@ -446,6 +446,7 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
   double non_young_start_time_sec = os::elapsedTime();
 
   if (collector_state()->in_mixed_phase()) {
+    candidates()->update_gc_efficiency_and_sort();
     candidates()->verify();
 
     uint num_initial_old_regions;
@@ -457,7 +458,7 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
                                                   num_optional_old_regions);
 
     // Prepare initial old regions.
-    move_candidates_to_collection_set(num_initial_old_regions);
+    move_candidates_to_collection_set(num_initial_old_regions, nullptr /* pss */);
 
     // Prepare optional old regions for evacuation.
     uint candidate_idx = candidates()->cur_idx();
@@ -476,7 +477,8 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
   QuickSort::sort(_collection_set_regions, _collection_set_cur_length, compare_region_idx, true);
 }
 
-void G1CollectionSet::move_candidates_to_collection_set(uint num_old_candidate_regions) {
+void G1CollectionSet::move_candidates_to_collection_set(uint num_old_candidate_regions,
+                                                        G1ParScanThreadStateSet* pss) {
   if (num_old_candidate_regions == 0) {
     return;
   }
@@ -486,6 +488,21 @@ void G1CollectionSet::move_candidates_to_collection_set(uint num_old_candidate_r
     // This potentially optional candidate region is going to be an actual collection
     // set region. Clear cset marker.
     _g1h->clear_region_attr(r);
+    if (r->has_pinned_objects()) {
+      // The region got pinned after it was selected as candidate. Drop it from
+      // the candidates like the chooser does for regions it does not select.
+      log_debug(gc, ergo, cset)("Skip old region %u with pinned objects", r->hrm_index());
+      if (r->has_index_in_opt_cset()) {
+        // Release it from the optional collection set like
+        // abandon_optional_collection_set() does.
+        assert(pss != nullptr, "must be given for optional regions");
+        pss->record_unused_optional_region(r);
+        r->clear_index_in_opt_cset();
+      }
+      r->rem_set()->clear(true /* only_cardset */);
+      _g1h->register_region_with_region_attr(r);
+      continue;
+    }
     add_old_region(r);
   }
   candidates()->remove(num_old_candidate_regions);
@@ -498,7 +515,8 @@ void G1CollectionSet::finalize_initial_collection_set(double target_pause_time_m
   finalize_old_part(time_remaining_ms);
 }
 
-bool G1CollectionSet::finalize_optional_for_evacuation(double remaining_pause_time) {
+bool G1CollectionSet::finalize_optional_for_evacuation(double remaining_pause_time,
+                                                       G1ParScanThreadStateSet* pss) {
   update_incremental_marker();
 
   uint num_selected_regions;
@@ -507,7 +525,7 @@ bool G1CollectionSet::finalize_optional_for_evacuation(double remaining_pause_ti
                                                      remaining_pause_time,
                                                      num_selected_regions);
 
-  move_candidates_to_collection_set(num_selected_regions);
+  move_candidates_to_collection_set(num_selected_regions, pss);
 
   _num_optional_regions -= num_selected_regions;
 
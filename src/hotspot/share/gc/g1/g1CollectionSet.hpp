@@ -241,7 +241,10 @@ class G1CollectionSet {
   // Add old region "hr" to optional collection set.
   void add_optional_region(HeapRegion* hr);
 
-  void move_candidates_to_collection_set(uint num_regions);
+  // Move the next num_regions candidates into the collection set. Pinned candidates
+  // are dropped instead; pss is used to account for dropped optional regions and
+  // may be null if none of the candidates are optional regions.
+  void move_candidates_to_collection_set(uint num_regions, G1ParScanThreadStateSet* pss);
 
   // Finalize the young part of the initial collection set. Relabel survivor regions
   // as Eden and calculate a prediction on how long the evacuation of all young regions
@@ -336,7 +339,7 @@ public:
   // few old gen regions.
   void finalize_initial_collection_set(double target_pause_time_ms, G1SurvivorRegions* survivor);
   // Finalize the next collection set from the set of available optional old gen regions.
-  bool finalize_optional_for_evacuation(double remaining_pause_time);
+  bool finalize_optional_for_evacuation(double remaining_pause_time, G1ParScanThreadStateSet* pss);
   // Abandon (clean up) optional collection set regions that were not evacuated in this
   // pause.
   void abandon_optional_collection_set(G1ParScanThreadStateSet* pss);
@@ -26,6 +26,7 @@
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
+#include "utilities/quickSort.hpp"
 
 void G1CollectionSetCandidates::remove(uint num_regions) {
   assert(num_regions <= num_remaining(), "Trying to remove more regions (%u) than available (%u)", num_regions, num_remaining());
@@ -54,6 +55,13 @@ void G1CollectionSetCandidates::remove_from_end(uint num_remove, size_t wasted)
   _remaining_reclaimable_bytes -= wasted;
 }
 
+void G1CollectionSetCandidates::update_gc_efficiency_and_sort() {
+  for (uint i = _front_idx; i < _num_regions; i++) {
+    _regions[i]->calc_gc_efficiency();
+  }
+  QuickSort::sort(_regions + _front_idx, num_remaining(), G1CollectionSetChooser::order_regions, true);
+}
+
 void G1CollectionSetCandidates::iterate(HeapRegionClosure* cl) {
   for (uint i = _front_idx; i < _num_regions; i++) {
     HeapRegion* r = _regions[i];
@@ -79,6 +79,12 @@ public:
   // Remove num_remove regions from the back of the collection set candidate list.
   void remove_from_end(uint num_remove, size_t wasted);
 
+  // Recalculate the gc efficiency of the remaining candidates and sort them
+  // again. Remembered sets keep growing during the mixed phase, so the order
+  // determined at the end of marking may not reflect the current cost of
+  // evacuating these regions any more.
+  void update_gc_efficiency_and_sort();
+
   // Iterate over all remaining collection set candidate regions.
   void iterate(HeapRegionClosure* cl);
   // Iterate over all remaining collectin set candidate regions from the end
@@ -26,6 +26,7 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
 #include "gc/shared/space.inline.hpp"
 #include "runtime/atomic.hpp"
@@ -38,7 +39,7 @@
 // hope is that the ones we'll skip are ones with both large remembered sets and
 // a lot of live objects, not the ones with just a lot of live objects if we
 // ordered according to the amount of reclaimable bytes per region.
-static int order_regions(HeapRegion* hr1, HeapRegion* hr2) {
+int G1CollectionSetChooser::order_regions(HeapRegion* hr1, HeapRegion* hr2) {
   // Make sure that NULL entries are moved to the end.
   if (hr1 == NULL) {
     if (hr2 == NULL) {
@@ -134,7 +135,7 @@ class G1BuildCandidateRegionsTask : public WorkerTask {
       for (uint i = _cur_claim_idx; i < _max_size; i++) {
         assert(_data[i] == NULL, "must be");
       }
-      QuickSort::sort(_data, _cur_claim_idx, order_regions, true);
+      QuickSort::sort(_data, _cur_claim_idx, G1CollectionSetChooser::order_regions, true);
       for (uint i = num_regions; i < _max_size; i++) {
         assert(_data[i] == NULL, "must be");
       }
@@ -253,6 +254,7 @@ uint G1CollectionSetChooser::calculate_work_chunk_size(uint num_workers, uint nu
 bool G1CollectionSetChooser::should_add(HeapRegion* hr) {
   return !hr->is_young() &&
          !hr->is_pinned() &&
+         !hr->has_pinned_objects() &&
          region_occupancy_low_enough_for_evac(hr->live_bytes()) &&
          hr->rem_set()->is_complete();
 }
@@ -57,6 +57,9 @@ public:
   // Regions also need a complete remembered set to be a candidate.
   static bool should_add(HeapRegion* hr);
 
+  // Comparator ordering regions by decreasing gc efficiency.
+  static int order_regions(HeapRegion* hr1, HeapRegion* hr2);
+
   // Build and return set of collection set candidates sorted by decreasing gc
   // efficiency.
   static G1CollectionSetCandidates* build(WorkerThreads* workers, uint max_num_regions);
@@ -34,6 +34,7 @@ G1EvacFailureRegions::G1EvacFailureRegions() :
   _regions_failed_evacuation(mtGC),
   _evac_failure_regions(nullptr),
   _evac_failure_regions_cur_length(0),
+  _num_regions_pinned(0),
   _max_regions(0) { }
 
 G1EvacFailureRegions::~G1EvacFailureRegions() {
@@ -42,6 +43,7 @@ G1EvacFailureRegions::~G1EvacFailureRegions() {
 
 void G1EvacFailureRegions::pre_collection(uint max_regions) {
   Atomic::store(&_evac_failure_regions_cur_length, 0u);
+  Atomic::store(&_num_regions_pinned, 0u);
   _max_regions = max_regions;
   _regions_failed_evacuation.resize(_max_regions);
   _evac_failure_regions = NEW_C_HEAP_ARRAY(uint, _max_regions, mtGC);
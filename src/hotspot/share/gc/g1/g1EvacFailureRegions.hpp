@@ -41,6 +41,9 @@ class G1EvacFailureRegions {
   uint* _evac_failure_regions;
   // Number of regions evacuation failed in the current collection.
   volatile uint _evac_failure_regions_cur_length;
+  // Number of regions retained because they contain pinned objects. Every object
+  // in such a region is retained, so no region is counted for both causes.
+  volatile uint _num_regions_pinned;
   // Maximum of regions number.
   uint _max_regions;
 
@@ -62,14 +65,34 @@ public:
     return Atomic::load(&_evac_failure_regions_cur_length);
   }
 
-  bool evacuation_failed() const {
+  uint num_regions_pinned() const {
+    return Atomic::load(&_num_regions_pinned);
+  }
+
+  uint num_regions_alloc_failed() const {
+    return num_regions_failed_evacuation() - num_regions_pinned();
+  }
+
+  // Whether any region has been retained in place, for any reason.
+  bool has_regions_evac_failed() const {
     return num_regions_failed_evacuation() > 0;
   }
 
-  // Record that the garbage collection encountered an evacuation failure in the
-  // given region. Returns whether this has been the first occurrence of an evacuation
-  // failure in that region.
-  inline bool record(uint region_idx);
+  // Whether any region has been retained because objects could not be copied.
+  bool has_regions_alloc_failed() const {
+    return num_regions_alloc_failed() > 0;
+  }
+
+  // Whether any region has been retained because it contains pinned objects.
+  bool has_regions_evac_pinned() const {
+    return num_regions_pinned() > 0;
+  }
+
+  // Record that the garbage collection retained objects in the given region,
+  // either because of an allocation failure or because the region contains
+  // pinned objects. Returns whether this has been the first occurrence in that
+  // region.
+  inline bool record(uint region_idx, bool cause_pinned);
 };
 
 #endif //SHARE_GC_G1_G1EVACFAILUREREGIONS_HPP
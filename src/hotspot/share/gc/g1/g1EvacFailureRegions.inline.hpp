@@ -29,13 +29,16 @@
 #include "runtime/atomic.hpp"
 #include "utilities/bitMap.inline.hpp"
 
-bool G1EvacFailureRegions::record(uint region_idx) {
+bool G1EvacFailureRegions::record(uint region_idx, bool cause_pinned) {
   assert(region_idx < _max_regions, "must be");
   bool success = _regions_failed_evacuation.par_set_bit(region_idx,
                                                         memory_order_relaxed);
   if (success) {
     size_t offset = Atomic::fetch_and_add(&_evac_failure_regions_cur_length, 1u);
     _evac_failure_regions[offset] = region_idx;
+    if (cause_pinned) {
+      Atomic::inc(&_num_regions_pinned, memory_order_relaxed);
+    }
   }
   return success;
 }
@@ -77,7 +77,8 @@ class G1FullCollector : StackObj {
   OopQueueSet               _oop_queue_set;
   ObjArrayTaskQueueSet      _array_queue_set;
   PreservedMarksSet         _preserved_marks_set;
-  G1FullGCCompactionPoint   _serial_compaction_point;
+  G1FullGCCompactionPoint** _tail_compaction_points;
+  uint                      _num_tail_compaction_points;
   G1IsAliveClosure          _is_alive;
   ReferenceProcessorIsAliveMutator _is_alive_mutator;
   G1RegionMarkStats*        _live_stats;
@@ -107,7 +108,14 @@ public:
   OopQueueSet*             oop_queue_set() { return &_oop_queue_set; }
   ObjArrayTaskQueueSet*    array_queue_set() { return &_array_queue_set; }
   PreservedMarksSet*       preserved_mark_set() { return &_preserved_marks_set; }
-  G1FullGCCompactionPoint* serial_compaction_point() { return &_serial_compaction_point; }
+  // The tail compaction points compact the last regions of the compaction
+  // queues in groups, if the parallel compaction does not free any region.
+  G1FullGCCompactionPoint* tail_compaction_point(uint id) { return _tail_compaction_points[id]; }
+  uint                     num_tail_compaction_points() { return _num_tail_compaction_points; }
+  void                     set_num_tail_compaction_points(uint num) {
+    assert(num <= _num_workers, "sanity");
+    _num_tail_compaction_points = num;
+  }
   G1CMBitMap*              mark_bitmap();
   ReferenceProcessor*      reference_processor();
   size_t live_words(uint region_index) {
@@ -33,6 +33,7 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/ticks.hpp"
 
 // Do work for all skip-compacting regions.
@@ -107,12 +108,18 @@ void G1FullGCCompactTask::work(uint worker_id) {
   log_task("Compaction task", worker_id, start);
 }
 
-void G1FullGCCompactTask::serial_compaction() {
-  GCTraceTime(Debug, gc, phases) tm("Phase 4: Serial Compaction", collector()->scope()->timer());
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->serial_compaction_point()->regions();
-  for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+void G1FullGCTailCompactTask::work(uint worker_id) {
+  Ticks start = Ticks::now();
+  uint num_groups = collector()->num_tail_compaction_points();
+  for (uint group = Atomic::fetch_and_add(&_next_group, 1u);
+       group < num_groups;
+       group = Atomic::fetch_and_add(&_next_group, 1u)) {
+    GrowableArray<HeapRegion*>* compaction_queue = collector()->tail_compaction_point(group)->regions();
+    for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
+         it != compaction_queue->end();
+         ++it) {
+      compact_region(*it);
+    }
   }
+  log_task("Tail compaction task", worker_id, start);
 }
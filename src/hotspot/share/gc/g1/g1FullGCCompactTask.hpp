@@ -38,15 +38,16 @@ class G1FullGCCompactTask : public G1FullGCTask {
 protected:
   HeapRegionClaimer _claimer;
 
-private:
   void compact_region(HeapRegion* hr);
 
+  G1FullGCCompactTask(const char* name, G1FullCollector* collector) :
+    G1FullGCTask(name, collector),
+    _claimer(collector->workers()) { }
+
 public:
   G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _claimer(collector->workers()) { }
+    G1FullGCCompactTask("G1 Compact Task", collector) { }
   void work(uint worker_id);
-  void serial_compaction();
 
   class G1CompactRegionClosure : public StackObj {
     G1CMBitMap* _bitmap;
@@ -57,4 +58,16 @@ public:
   };
 };
 
+// Compacts the groups of regions set up by G1FullGCPrepareTask::prepare_tail_compaction().
+// The groups are independent of each other, so each is compacted by a single worker.
+class G1FullGCTailCompactTask : public G1FullGCCompactTask {
+  volatile uint _next_group;
+
+public:
+  G1FullGCTailCompactTask(G1FullCollector* collector) :
+    G1FullGCCompactTask("G1 Tail Compact Task", collector),
+    _next_group(0) { }
+  void work(uint worker_id);
+};
+
 #endif // SHARE_GC_G1_G1FULLGCCOMPACTTASK_HPP
@@ -73,6 +73,14 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
       }
     } else if (hr->is_closed_archive()) {
       // nothing to do with closed archive region
+    } else if (hr->has_pinned_objects()) {
+      // Objects in this region are pinned by JNI critical sections; the
+      // region was already marked skip-compacting before marking.
+      if (hr->is_young()) {
+        hr->update_bot();
+      }
+      log_trace(gc, phases)("Phase 2: skip compaction region index: %u, pinned objects: " SIZE_FORMAT,
+                            hr->hrm_index(), hr->pinned_count());
     } else {
       assert(MarkSweepDeadRatio > 0,
              "only skip compaction for other regions when MarkSweepDeadRatio > 0");
@@ -137,7 +145,7 @@ G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1Fu
     _regions_freed(false) { }
 
 bool G1FullGCPrepareTask::G1CalculatePointersClosure::should_compact(HeapRegion* hr) {
-  if (hr->is_pinned()) {
+  if (hr->is_pinned() || hr->has_pinned_objects()) {
     return false;
   }
   size_t live_words = _collector->live_words(hr->hrm_index());
@@ -199,36 +207,62 @@ void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(Hea
   prepare_for_compaction_work(_cp, hr);
 }
 
-void G1FullGCPrepareTask::prepare_serial_compaction() {
-  GCTraceTime(Debug, gc, phases) debug("Phase 2: Prepare Serial Compaction", collector()->scope()->timer());
+void G1FullGCPrepareTask::prepare_tail_compaction() {
+  GCTraceTime(Debug, gc, phases) debug("Phase 2: Prepare Tail Compaction", collector()->scope()->timer());
   // At this point we know that no regions were completely freed by
   // the parallel compaction. That means that the last region of
   // all compaction queues still have data in them. We try to compact
-  // these regions in serial to avoid a premature OOM.
+  // these regions to avoid a premature OOM.
+  //
+  // The last regions are split into groups of consecutive regions, which
+  // are compacted independently and in parallel. Each group needs to be
+  // large enough to have a reasonable chance of freeing a region.
+  const uint MinRegionsPerGroup = 4;
+
+  uint num_tail_regions = 0;
+  for (uint i = 0; i < collector()->workers(); i++) {
+    if (collector()->compaction_point(i)->has_regions()) {
+      num_tail_regions++;
+    }
+  }
+  if (num_tail_regions == 0) {
+    return;
+  }
+
+  const uint num_groups = MAX2(1u, num_tail_regions / MinRegionsPerGroup);
+  collector()->set_num_tail_compaction_points(num_groups);
+
+  uint tail_index = 0;
   for (uint i = 0; i < collector()->workers(); i++) {
     G1FullGCCompactionPoint* cp = collector()->compaction_point(i);
     if (cp->has_regions()) {
-      collector()->serial_compaction_point()->add(cp->remove_last());
+      uint group = tail_index * num_groups / num_tail_regions;
+      collector()->tail_compaction_point(group)->add(cp->remove_last());
+      tail_index++;
     }
   }
 
-  // Update the forwarding information for the regions in the serial
-  // compaction point.
-  G1FullGCCompactionPoint* cp = collector()->serial_compaction_point();
-  for (GrowableArrayIterator<HeapRegion*> it = cp->regions()->begin(); it != cp->regions()->end(); ++it) {
-    HeapRegion* current = *it;
-    if (!cp->is_initialized()) {
-      // Initialize the compaction point. Nothing more is needed for the first heap region
-      // since it is already prepared for compaction.
-      cp->initialize(current, false);
-    } else {
-      assert(!current->is_humongous(), "Should be no humongous regions in compaction queue");
-      G1RePrepareClosure re_prepare(cp, current);
-      current->set_compaction_top(current->bottom());
-      current->apply_to_marked_objects(collector()->mark_bitmap(), &re_prepare);
+  // Update the forwarding information for the regions in the tail
+  // compaction points.
+  for (uint group = 0; group < num_groups; group++) {
+    G1FullGCCompactionPoint* cp = collector()->tail_compaction_point(group);
+    for (GrowableArrayIterator<HeapRegion*> it = cp->regions()->begin(); it != cp->regions()->end(); ++it) {
+      HeapRegion* current = *it;
+      if (!cp->is_initialized()) {
+        // Initialize the compaction point. Nothing more is needed for the first heap region
+        // since it is already prepared for compaction.
+        cp->initialize(current, false);
+      } else {
+        assert(!current->is_humongous(), "Should be no humongous regions in compaction queue");
+        G1RePrepareClosure re_prepare(cp, current);
+        current->set_compaction_top(current->bottom());
+        current->apply_to_marked_objects(collector()->mark_bitmap(), &re_prepare);
+      }
     }
+    cp->update();
   }
-  cp->update();
+
+  log_debug(gc, phases)("Phase 2: Tail compaction of %u regions in %u groups", num_tail_regions, num_groups);
 }
 
 bool G1FullGCPrepareTask::G1CalculatePointersClosure::freed_regions() {
@@ -45,7 +45,7 @@ protected:
 public:
   G1FullGCPrepareTask(G1FullCollector* collector);
   void work(uint worker_id);
-  void prepare_serial_compaction();
+  void prepare_tail_compaction();
   bool has_freed_regions();
 
 protected:
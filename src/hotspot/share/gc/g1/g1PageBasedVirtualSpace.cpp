@@ -24,12 +24,15 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1PageBasedVirtualSpace.hpp"
+#include "gc/g1/g1_globals.hpp"
 #include "gc/shared/pretouchTask.hpp"
 #include "gc/shared/workerThread.hpp"
+#include "logging/log.hpp"
 #include "oops/markWord.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
@@ -141,6 +144,16 @@ void G1PageBasedVirtualSpace::commit_preferred_pages(size_t start, size_t num_pa
   size_t size = num_pages * _page_size;
 
   os::commit_memory_or_exit(start_addr, size, _page_size, _executable, "G1 virtual space");
+
+  // Collapsing untouched memory populates it, which is an implicit pre-touch.
+  // Only pay for that inside a pause if the memory is pre-touched anyway.
+  if (G1CollapseLargePages && UseTransparentHugePages && _page_size > os::vm_page_size() &&
+      (AlwaysPreTouch || !SafepointSynchronize::is_at_safepoint())) {
+    if (!os::collapse_large_pages(start_addr, size)) {
+      log_debug(gc, heap)("Could not collapse " PTR_FORMAT "-" PTR_FORMAT " into large pages",
+                          p2i(start_addr), p2i(start_addr + size));
+    }
+  }
 }
 
 void G1PageBasedVirtualSpace::commit_tail() {
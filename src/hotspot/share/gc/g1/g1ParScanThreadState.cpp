@@ -33,6 +33,7 @@
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGCEvacFailureInjector.inline.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/shared/partialArrayTaskStepper.inline.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
@@ -451,6 +452,10 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
+  if (from_region->has_pinned_objects()) {
+    // Objects in regions pinned by JNI critical sections stay in place.
+    return handle_pinned_object_par(old, old_mark);
+  }
   uint node_index = from_region->node_index();
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
@@ -604,8 +609,7 @@ void G1ParScanThreadStateSet::record_unused_optional_region(HeapRegion* hr) {
   }
 }
 
-NOINLINE
-oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, size_t word_sz) {
+oop G1ParScanThreadState::retain_in_place_par(oop old, markWord m, bool cause_pinned) {
   assert(_g1h->is_in_cset(old), "Object " PTR_FORMAT " should be in the CSet", p2i(old));
 
   oop forward_ptr = old->forward_to_atomic(old, m, memory_order_relaxed);
@@ -616,12 +620,11 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
     // of these objs later in *remove self forward* phase of post evacuation.
     r->record_evac_failure_obj(old);
 
-    if (_evac_failure_regions->record(r->hrm_index())) {
+    if (_evac_failure_regions->record(r->hrm_index(), cause_pinned) && !cause_pinned) {
       _g1h->hr_printer()->evac_failure(r);
     }
 
     _preserved_marks->push_if_necessary(old, m);
-    _evacuation_failed_info.register_copy_failure(word_sz);
 
     // For iterating objects that failed evacuation currently we can reuse the
     // existing closure to scan evacuated objects because:
@@ -646,6 +649,20 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
   }
 }
 
+NOINLINE
+oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, size_t word_sz) {
+  oop result = retain_in_place_par(old, m, false /* cause_pinned */);
+  if (result == old) {
+    _evacuation_failed_info.register_copy_failure(word_sz);
+  }
+  return result;
+}
+
+NOINLINE
+oop G1ParScanThreadState::handle_pinned_object_par(oop old, markWord m) {
+  return retain_in_place_par(old, m, true /* cause_pinned */);
+}
+
 void G1ParScanThreadState::initialize_numa_stats() {
   if (_numa->is_enabled()) {
     LogTarget(Info, gc, heap, numa) lt;
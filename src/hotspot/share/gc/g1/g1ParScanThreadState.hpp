@@ -214,9 +214,17 @@ public:
   Tickspan trim_ticks() const;
   void reset_trim_ticks();
 
+  // Forwards "obj" to itself and retains its region in place. Returns the
+  // forwardee if another thread installed a forwarding pointer first.
+  oop retain_in_place_par(oop obj, markWord m, bool cause_pinned);
+
   // An attempt to evacuate "obj" has failed; take necessary steps.
   oop handle_evacuation_failure_par(oop obj, markWord m, size_t word_sz);
 
+  // "obj" is in a region with objects pinned by JNI critical sections and
+  // must stay where it is. This is not an evacuation failure.
+  oop handle_pinned_object_par(oop obj, markWord m);
+
   template <typename T>
   inline void remember_root_into_optional_region(T* p);
   template <typename T>
@@ -34,6 +34,12 @@
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+uintx G1PeriodicGCTask::pressure_gc_interval(double pressure) {
+  uintx base = (G1PeriodicGCInterval == 0) ? PressureGCMaxIntervalMs : G1PeriodicGCInterval;
+  uintx interval = (uintx)(base * (G1PeriodicGCMemoryPressureThreshold / pressure));
+  return clamp(interval, MIN2(base, PressureGCMinIntervalMs), base);
+}
+
 bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
                                                 G1GCCounters* counters) {
   // Ensure no GC safepoints while we're doing the checks, to avoid data races.
@@ -45,11 +51,25 @@ bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
     return false;
   }
 
-  // Check if enough time has passed since the last GC.
+  // Check if enough time has passed since the last GC. Under memory pressure,
+  // give memory back sooner.
   uintx time_since_last_gc = (uintx)g1h->time_since_last_collection().milliseconds();
-  if ((time_since_last_gc < G1PeriodicGCInterval)) {
+  uintx interval = G1PeriodicGCInterval;
+  double pressure;
+  if ((G1PeriodicGCMemoryPressureThreshold > 0.0) &&
+      (os::memory_pressure(&pressure) == 0) &&
+      (pressure > G1PeriodicGCMemoryPressureThreshold)) {
+    interval = pressure_gc_interval(pressure);
+    log_debug(gc, periodic)("Memory pressure %1.2f is higher than threshold %1.2f. Using interval " UINTX_FORMAT "ms.",
+                            pressure, G1PeriodicGCMemoryPressureThreshold, interval);
+  }
+  if (interval == 0) {
+    log_debug(gc, periodic)("No memory pressure. Skipping.");
+    return false;
+  }
+  if (time_since_last_gc < interval) {
     log_debug(gc, periodic)("Last GC occurred " UINTX_FORMAT "ms before which is below threshold " UINTX_FORMAT "ms. Skipping.",
-                            time_since_last_gc, G1PeriodicGCInterval);
+                            time_since_last_gc, interval);
     return false;
   }
 
@@ -71,7 +91,7 @@ bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
 
 void G1PeriodicGCTask::check_for_periodic_gc() {
   // If disabled, just return.
-  if (G1PeriodicGCInterval == 0) {
+  if (G1PeriodicGCInterval == 0 && G1PeriodicGCMemoryPressureThreshold == 0.0) {
     return;
   }
 
@@ -93,6 +113,11 @@ void G1PeriodicGCTask::execute() {
   // G1PeriodicGCInterval is a manageable flag and can be updated
   // during runtime. If no value is set, wait a second and run it
   // again to see if the value has been updated. Otherwise use the
-  // real value provided.
-  schedule(G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval);
+  // real value provided. Memory pressure is checked at least once a
+  // second.
+  uintx delay = G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval;
+  if (G1PeriodicGCMemoryPressureThreshold > 0.0) {
+    delay = MIN2(delay, PressureGCMinIntervalMs);
+  }
+  schedule(delay);
 }
@@ -32,6 +32,16 @@ class G1GCCounters;
 
 // Task handling periodic GCs
 class G1PeriodicGCTask : public G1ServiceTask {
+  // Minimum time between periodic GCs triggered by memory pressure.
+  static const uintx PressureGCMinIntervalMs = 1000;
+  // Time between periodic GCs at the memory pressure threshold if
+  // G1PeriodicGCInterval is not set.
+  static const uintx PressureGCMaxIntervalMs = 60000;
+
+  // The periodic GC interval for the given memory pressure above the
+  // threshold, shrinking in proportion to the pressure.
+  static uintx pressure_gc_interval(double pressure);
+
   bool should_start_periodic_gc(G1CollectedHeap* g1h,
                                 G1GCCounters* counters);
   void check_for_periodic_gc();
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1PreTouchTask.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Regions committed after the initial heap expansion are pre-touched when they
+// are committed, so only the regions up to the highest initially committed one
+// need to be touched here.
+static uint initial_committed_end() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  for (uint i = g1h->max_reserved_regions(); i > 0; i--) {
+    if (g1h->region_at_or_null(i - 1) != NULL) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+// Unlike os::pretouch_memory(), which stores zeros, touch each page with an
+// atomic add of zero. That leaves the contents unchanged, so it is safe on
+// memory the mutators may already be using.
+static void pretouch_in_use_memory(void* start, void* end, size_t page_size) {
+  for (char* p = (char*)start; p < (char*)end; p += page_size) {
+    Atomic::add(reinterpret_cast<int*>(p), 0, memory_order_relaxed);
+  }
+}
+
+G1PreTouchTask::G1PreTouchTask(size_t page_size) :
+  G1ServiceTask("G1 Pre-Touch Task"),
+  // When using THP we need to always pre-touch using small pages as the OS will
+  // initially always use small pages.
+  _page_size(UseTransparentHugePages ? (size_t)os::vm_page_size() : page_size),
+  _next_region(initial_committed_end()),
+  _touched_bytes(0) { }
+
+void G1PreTouchTask::execute() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  size_t touched = 0;
+
+  // Eden regions are taken from the top of the free list, so walk the heap
+  // downwards to reach them before the mutators do. Regions are only
+  // uncommitted by other tasks on the service thread, so a committed region
+  // stays committed while it is touched. Pre-touching does not change the
+  // memory contents, so it is fine if the region is already in use.
+  while (_next_region > 0 && touched < PreTouchSizeLimit) {
+    HeapRegion* hr = g1h->region_at_or_null(--_next_region);
+    if (hr != NULL) {
+      pretouch_in_use_memory(hr->bottom(), hr->end(), _page_size);
+      touched += HeapRegion::GrainBytes;
+    }
+  }
+  _touched_bytes += touched;
+
+  if (_next_region > 0) {
+    schedule(PreTouchTaskDelayMs);
+  } else {
+    log_info(gc, heap)("Concurrent pre-touch of the Java heap completed: " SIZE_FORMAT "M",
+                       _touched_bytes / M);
+  }
+}
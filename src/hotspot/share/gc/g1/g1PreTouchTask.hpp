@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1PRETOUCHTASK_HPP
+#define SHARE_GC_G1_G1PRETOUCHTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+
+// Pre-touches the initially committed Java heap after startup, see
+// G1PreTouchConcurrently.
+class G1PreTouchTask : public G1ServiceTask {
+  // Each execution of the task is limited to pre-touch at most 256M so that
+  // other service tasks are not delayed for long.
+  static const size_t PreTouchSizeLimit = 256 * M;
+  // The delay between two pre-touch task executions.
+  static const uint PreTouchTaskDelayMs = 10;
+
+  size_t _page_size;
+  // Regions below this index remain to be pre-touched.
+  uint _next_region;
+  size_t _touched_bytes;
+
+public:
+  G1PreTouchTask(size_t page_size);
+  virtual void execute();
+};
+
+#endif // SHARE_GC_G1_G1PRETOUCHTASK_HPP
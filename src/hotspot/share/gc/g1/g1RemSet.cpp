@@ -56,6 +56,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -650,15 +652,20 @@ private:
     return (value & ToScanMask) == 0;
   }
 
-  bool cur_word_of_cards_contains_any_dirty_card() const {
+  size_t cur_word_of_cards() const {
     assert(cur_addr_aligned(), "Current address should be aligned");
-    size_t const value = *(size_t*)_cur_addr;
-    return (~value & ExpandedToScanMask) != 0;
+    return *(size_t*)_cur_addr;
   }
 
-  bool cur_word_of_cards_all_dirty_cards() const {
-    size_t const value = *(size_t*)_cur_addr;
-    return value == G1CardTable::WordAllDirty;
+  // Returns the index of the first card within a word of cards given the
+  // ToScanMask bits of the cards of interest, avoiding a per-card loop.
+  static size_t first_card_in_word(size_t card_bits) {
+    assert(card_bits != 0, "Must have at least one card");
+#ifdef VM_LITTLE_ENDIAN
+    return count_trailing_zeros(card_bits) / BitsPerByte;
+#else
+    return count_leading_zeros(card_bits) / BitsPerByte;
+#endif
   }
 
   size_t get_and_advance_pos() {
@@ -686,14 +693,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (cur_word_of_cards_contains_any_dirty_card()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a dirty card in the word.");
+      size_t const dirty_bits = ~cur_word_of_cards() & ExpandedToScanMask;
+      if (dirty_bits != 0) {
+        _cur_addr += first_card_in_word(dirty_bits);
+        assert(cur_card_is_dirty(), "Should have found the dirty card in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
@@ -712,14 +716,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (!cur_word_of_cards_all_dirty_cards()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (!cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a non-dirty card in the word.");
+      size_t const non_dirty_bits = cur_word_of_cards() & ExpandedToScanMask;
+      if (non_dirty_bits != 0) {
+        _cur_addr += first_card_in_word(non_dirty_bits);
+        assert(!cur_card_is_dirty(), "Should have found the non-dirty card in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
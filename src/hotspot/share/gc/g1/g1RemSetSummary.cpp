@@ -35,6 +35,7 @@
 #include "gc/g1/heapRegionRemSet.inline.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 
 void G1RemSetSummary::update() {
@@ -206,6 +207,10 @@ private:
   size_t _max_rs_mem_sz;
   HeapRegion* _max_rs_mem_sz_region;
 
+  // Card set container statistics; only available at a safepoint.
+  G1CardSetContainerStats _container_stats;
+  bool _has_container_stats;
+
   size_t total_rs_wasted_mem_sz() const     { return _all.rs_wasted_mem_size(); }
   size_t total_rs_mem_sz() const            { return _all.rs_mem_size(); }
   size_t total_cards_occupied() const       { return _all.cards_occupied(); }
@@ -226,6 +231,7 @@ public:
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _archive("Archive"), _all("All"),
     _max_rs_mem_sz(0), _max_rs_mem_sz_region(NULL),
+    _container_stats(), _has_container_stats(SafepointSynchronize::is_at_safepoint()),
     _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(NULL)
   {}
 
@@ -241,6 +247,9 @@ public:
       _max_rs_mem_sz_region = r;
     }
     size_t occupied_cards = hrrs->occupied();
+    if (_has_container_stats) {
+      hrrs->collect_container_stats(&_container_stats);
+    }
     size_t code_root_mem_sz = hrrs->strong_code_roots_mem_size();
     if (code_root_mem_sz > max_code_root_mem_sz()) {
       _max_code_root_mem_sz = code_root_mem_sz;
@@ -297,6 +306,11 @@ public:
                   rem_set->mem_size(),
                   rem_set->occupied());
 
+    if (_has_container_stats) {
+      out->print_cr("  Card set containers");
+      _container_stats.print_on(out);
+    }
+
     HeapRegionRemSet::print_static_mem_size(out);
     G1CardSetFreePool::free_list_pool()->print_on(out);
 
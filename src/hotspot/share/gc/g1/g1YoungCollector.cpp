@@ -47,6 +47,7 @@
 #include "gc/g1/g1YoungCollector.hpp"
 #include "gc/g1/g1YoungGCPostEvacuateTasks.hpp"
 #include "gc/g1/g1_globals.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/gcTimer.hpp"
@@ -152,7 +153,7 @@ public:
   }
 
   ~G1YoungGCNotifyPauseMark() {
-    G1CollectedHeap::heap()->policy()->record_young_gc_pause_end(_collector->evacuation_failed());
+    G1CollectedHeap::heap()->policy()->record_young_gc_pause_end(_collector->evacuation_retained_regions());
   }
 };
 
@@ -203,7 +204,7 @@ public:
   ~G1YoungGCVerifierMark() {
     // Inject evacuation failure tag into type if needed.
     G1HeapVerifier::G1VerifyType type = _type;
-    if (_collector->evacuation_failed()) {
+    if (_collector->evacuation_retained_regions()) {
       type = (G1HeapVerifier::G1VerifyType)(type | G1HeapVerifier::G1VerifyYoungEvacFail);
     }
     G1CollectedHeap::heap()->verify_after_young_collection(type);
@@ -378,12 +379,15 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
+      // Humongous objArrays are only nominated outside of concurrent
+      // marking and remembered set rebuild, which trivially satisfies the
+      // constraints above. The remembered set entries their references
+      // induced on other regions become stale if they are reclaimed. This
+      // is fine, as card scanning never looks above the scan top of a
+      // region, and the scan top of a region that has been freed and reused
+      // since is reset.
       //
-      // We also treat is_typeArray() objects specially, allowing them
+      // We treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
       // concurrent mark.  For this we rely on mark stack insertion to
       // exclude is_typeArray() objects, preventing reclaiming an object
@@ -392,8 +396,16 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
+      if (!obj->is_typeArray()) {
+        G1CollectorState* state = _g1h->collector_state();
+        if (!obj->is_objArray() ||
+            state->in_concurrent_start_gc() ||
+            state->mark_or_rebuild_in_progress()) {
+          return false;
+        }
+      }
 
-      return obj->is_typeArray() &&
+      return !region->has_pinned_objects() &&
              _g1h->is_potential_eager_reclaim_candidate(region);
     }
 
@@ -817,7 +829,8 @@ void G1YoungCollector::evacuate_optional_collection_set(G1ParScanThreadStateSet*
     double time_left_ms = MaxGCPauseMillis - time_used_ms;
 
     if (time_left_ms < 0 ||
-        !collection_set()->finalize_optional_for_evacuation(time_left_ms * policy()->optional_evacuation_fraction())) {
+        !collection_set()->finalize_optional_for_evacuation(time_left_ms * policy()->optional_evacuation_fraction(),
+                                                            per_thread_states)) {
       log_trace(gc, ergo, cset)("Skipping evacuation of %u optional regions, no more regions can be evacuated in %.3fms",
                                 collection_set()->optional_region_length(), time_left_ms);
       break;
@@ -1034,6 +1047,13 @@ void G1YoungCollector::post_evacuate_collection_set(G1EvacInfo* evacuation_info,
 
   post_evacuate_cleanup_2(per_thread_states, evacuation_info);
 
+  if (evacuation_retained_regions()) {
+    log_debug(gc)("Retained regions: %u (pinned: %u, evacuation failed: %u)",
+                  _evac_failure_regions.num_regions_failed_evacuation(),
+                  _evac_failure_regions.num_regions_pinned(),
+                  _evac_failure_regions.num_regions_alloc_failed());
+  }
+
   _evac_failure_regions.post_collection();
 
   assert_used_and_recalculate_used_equal(_g1h);
@@ -1055,7 +1075,11 @@ void G1YoungCollector::post_evacuate_collection_set(G1EvacInfo* evacuation_info,
 }
 
 bool G1YoungCollector::evacuation_failed() const {
-  return _evac_failure_regions.evacuation_failed();
+  return _evac_failure_regions.has_regions_alloc_failed();
+}
+
+bool G1YoungCollector::evacuation_retained_regions() const {
+  return _evac_failure_regions.has_regions_evac_failed();
 }
 
 class G1PreservedMarksSet : public PreservedMarksSet {
@@ -133,6 +133,9 @@ class G1YoungCollector {
 
   // True iff an evacuation has failed in the most-recent collection.
   bool evacuation_failed() const;
+  // True iff any region has been retained in place in the most-recent
+  // collection, either because of evacuation failure or pinned objects.
+  bool evacuation_retained_regions() const;
 
 #if TASKQUEUE_STATS
   uint num_task_queues() const;
@@ -108,7 +108,7 @@ public:
     _evac_failure_regions(evac_failure_regions) { }
 
   double worker_cost() const override {
-    assert(_evac_failure_regions->evacuation_failed(), "Should not call this if not executed");
+    assert(_evac_failure_regions->has_regions_evac_failed(), "Should not call this if not executed");
     return _evac_failure_regions->num_regions_failed_evacuation();
   }
 
@@ -121,7 +121,7 @@ G1PostEvacuateCollectionSetCleanupTask1::G1PostEvacuateCollectionSetCleanupTask1
                                                                                  G1EvacFailureRegions* evac_failure_regions) :
   G1BatchedTask("Post Evacuate Cleanup 1", G1CollectedHeap::heap()->phase_times())
 {
-  bool evacuation_failed = evac_failure_regions->evacuation_failed();
+  bool evacuation_failed = evac_failure_regions->has_regions_evac_failed();
 
   add_serial_task(new MergePssTask(per_thread_states));
   add_serial_task(new RecalculateUsedTask(evacuation_failed));
@@ -166,10 +166,10 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
   // So there is no need to re-check remembered set size of the humongous region.
   //
   // Other implementation considerations:
-  // - never consider object arrays at this time because they would pose
-  // considerable effort for cleaning up the the remembered sets. This is
-  // required because stale remembered sets might reference locations that
-  // are currently allocated into.
+  // - object arrays are only considered outside of concurrent marking. The
+  // remembered set entries induced by their references become stale when they
+  // are reclaimed, but card scanning never looks above the scan top of the
+  // region containing the card.
   bool is_reclaimable(uint region_idx) const {
     return G1CollectedHeap::heap()->is_humongous_reclaim_candidate(region_idx);
   }
@@ -192,8 +192,8 @@ public:
     }
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || obj->is_objArray(),
+              "Only eagerly reclaiming arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")",
@@ -677,7 +677,7 @@ G1PostEvacuateCollectionSetCleanupTask2::G1PostEvacuateCollectionSetCleanupTask2
     add_serial_task(new EagerlyReclaimHumongousObjectsTask());
   }
 
-  if (evac_failure_regions->evacuation_failed()) {
+  if (evac_failure_regions->has_regions_evac_failed()) {
     add_parallel_task(new RestorePreservedMarksTask(per_thread_states->preserved_marks_set()));
   }
   add_parallel_task(new RedirtyLoggedCardsTask(per_thread_states->rdcqs(), evac_failure_regions));
@@ -158,6 +158,13 @@
           "When expanding, % of uncommitted space to claim.")               \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, G1CollapseLargePages, false, EXPERIMENTAL,                  \
+          "Back newly committed heap and auxiliary data memory with "       \
+          "transparent huge pages immediately instead of waiting for "      \
+          "the OS to do it. This populates the memory, like pre-touching "  \
+          "it, so memory committed during a pause is only collapsed with "  \
+          "AlwaysPreTouch. Requires UseTransparentHugePages")               \
+                                                                            \
   product(size_t, G1UpdateBufferSize, 256,                                  \
           "Size of an update buffer")                                       \
           range(1, NOT_LP64(32*M) LP64_ONLY(1*G))                           \
@@ -206,6 +213,11 @@
           "Log base 2 of the length of conc RS hot-card cache.")            \
           range(0, 27)                                                      \
                                                                             \
+  product(bool, G1ScaleHotCardCache, false, EXPERIMENTAL,                   \
+          "If G1ConcRSLogCacheSize is not set, size the hot card cache "    \
+          "with one entry per megabyte of maximum heap, up to 2^16 "        \
+          "entries. This moves more refinement into the pause.")            \
+                                                                            \
   product(uintx, G1ConcRSHotCardLimit, 4,                                   \
           "The threshold that defines (>=) a hot card.")                    \
           range(0, max_jubyte)                                              \
@@ -352,6 +364,21 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(double, G1PeriodicGCMemoryPressureThreshold, 0.0, MANAGEABLE,     \
+          "Recent system memory pressure, as the percentage of time tasks " \
+          "stalled on memory, above which G1 triggers a periodic GC to "    \
+          "shrink the heap without waiting for G1PeriodicGCInterval. "      \
+          "The interval shrinks in proportion to the pressure, down to "    \
+          "one second. In containers the pressure of the container's "      \
+          "cgroup is used, which requires cgroup v2. A value of zero "      \
+          "disables this check.")                                           \
+          range(0.0, 100.0)                                                 \
+                                                                            \
+  product(bool, G1PreTouchConcurrently, false, EXPERIMENTAL,                \
+          "With AlwaysPreTouch, pre-touch the initial Java heap on the "    \
+          "service thread after startup instead of during heap "            \
+          "initialization.")                                                \
+                                                                            \
   product(uint, G1RemSetFreeMemoryRescheduleDelayMillis, 10, EXPERIMENTAL,  \
           "Time after which the card set free memory task reschedules "     \
           "itself if there is work remaining.")                             \
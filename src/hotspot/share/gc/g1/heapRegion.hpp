@@ -269,6 +269,9 @@ private:
 
   uint _node_index;
 
+  // Number of objects in this region currently pinned by JNI critical sections.
+  volatile size_t _pinned_object_count;
+
   G1EvacFailureObjectsSet _evac_failure_objs;
 
   void report_region_type_change(G1HeapRegionTraceType::Type to);
@@ -423,6 +426,14 @@ public:
   // Humongous regions and archive regions are pinned.
   bool is_pinned() const { return _type.is_pinned(); }
 
+  // Objects in this region are referenced by active JNI critical sections and
+  // must not be moved. Unlike the pinned region types above this is a
+  // transient state; evacuation keeps such regions in place.
+  inline bool has_pinned_objects() const;
+  inline size_t pinned_count() const;
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+
   // An archive region is a pinned region, also tagged as old, which
   // should not be marked during mark/sweep. This allows the address
   // space to be shared by JVM instances.
@@ -453,4 +453,21 @@ inline void HeapRegion::record_evac_failure_obj(oop obj) {
   _evac_failure_objs.record(obj);
 }
 
+inline size_t HeapRegion::pinned_count() const {
+  return Atomic::load(&_pinned_object_count);
+}
+
+inline bool HeapRegion::has_pinned_objects() const {
+  return pinned_count() > 0;
+}
+
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "region %u must have pinned objects", hrm_index());
+  Atomic::dec(&_pinned_object_count, memory_order_relaxed);
+}
+
 #endif // SHARE_GC_G1_HEAPREGION_INLINE_HPP
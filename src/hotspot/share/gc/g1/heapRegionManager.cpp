@@ -140,10 +140,10 @@ HeapRegion* HeapRegionManager::allocate_humongous_allow_expand(uint num_regions)
   return allocate_free_regions_starting_at(candidate, num_regions);
 }
 
-HeapRegion* HeapRegionManager::allocate_humongous(uint num_regions) {
+HeapRegion* HeapRegionManager::allocate_humongous(uint num_regions, uint requested_node_index) {
   // Special case a single region to avoid expensive search.
   if (num_regions == 1) {
-    return allocate_free_region(HeapRegionType::Humongous, G1NUMA::AnyNodeIndex);
+    return allocate_free_region(HeapRegionType::Humongous, requested_node_index);
   }
   return allocate_humongous_from_free_list(num_regions);
 }
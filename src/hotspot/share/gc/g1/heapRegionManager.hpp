@@ -207,8 +207,9 @@ public:
   // Allocate a free region with specific node index. If fails allocate with next node index.
   HeapRegion* allocate_free_region(HeapRegionType type, uint requested_node_index);
 
-  // Allocate a humongous object from the free list
-  HeapRegion* allocate_humongous(uint num_regions);
+  // Allocate a humongous object from the free list. Single region humongous
+  // objects prefer a region on the requested node.
+  HeapRegion* allocate_humongous(uint num_regions, uint requested_node_index);
 
   // Allocate a humongous object by expanding the heap
   HeapRegion* expand_and_allocate_humongous(uint num_regions);
@@ -89,6 +89,10 @@ public:
     return _card_set.occupied();
   }
 
+  void collect_container_stats(G1CardSetContainerStats* stats) {
+    _card_set.collect_container_stats(stats);
+  }
+
   static void initialize(MemRegion reserved);
 
   // Coarsening statistics since VM start.
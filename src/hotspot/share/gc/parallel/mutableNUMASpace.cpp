@@ -379,7 +379,9 @@ void MutableNUMASpace::update() {
     }
   }
 
-  scan_pages(NUMAPageScanRate);
+  if (UseNUMAPageScanning) {
+    scan_pages(NUMAPageScanRate);
+  }
 }
 
 // Scan pages. Free pages that have smaller size or wrong placement.
@@ -893,28 +895,30 @@ void MutableNUMASpace::LGRPSpace::accumulate_statistics(size_t page_size) {
   char *start = (char*)align_up(space()->bottom(), page_size);
   char* end = (char*)align_down(space()->end(), page_size);
   if (start < end) {
+    const size_t batch_size = 64;
+    os::page_info info[batch_size];
     for (char *p = start; p < end;) {
-      os::page_info info;
-      if (os::get_page_info(p, &info)) {
-        if (info.size > 0) {
-          if (info.size > (size_t)os::vm_page_size()) {
+      size_t count = MIN2(batch_size, pointer_delta(end, p, page_size));
+      if (!os::get_page_info(p, page_size, count, info)) {
+        return;
+      }
+      for (size_t i = 0; i < count; i++) {
+        if (info[i].size > 0) {
+          if (info[i].size > (size_t)os::vm_page_size()) {
             space_stats()->_large_pages++;
           } else {
             space_stats()->_small_pages++;
           }
-          if (info.lgrp_id == lgrp_id()) {
-            space_stats()->_local_space += info.size;
+          if (info[i].lgrp_id == lgrp_id()) {
+            space_stats()->_local_space += info[i].size;
           } else {
-            space_stats()->_remote_space += info.size;
+            space_stats()->_remote_space += info[i].size;
           }
-          p += info.size;
         } else {
-          p += os::vm_page_size();
-          space_stats()->_uncommited_space += os::vm_page_size();
+          space_stats()->_uncommited_space += page_size;
         }
-      } else {
-        return;
       }
+      p += count * page_size;
     }
   }
   space_stats()->_unbiased_space = pointer_delta(start, space()->bottom(), sizeof(char)) +
@@ -952,7 +956,11 @@ void MutableNUMASpace::LGRPSpace::scan_pages(size_t page_size, size_t page_count
 
       if ((page_expected.size != page_size || page_expected.lgrp_id != lgrp_id())
           && page_expected.size != 0) {
-        os::free_memory(s, pointer_delta(e, s, sizeof(char)), page_size);
+        size_t size = pointer_delta(e, s, sizeof(char));
+        os::free_memory(s, size, page_size);
+        // Freeing may drop the node binding of the range, e.g. on Linux,
+        // where the range is mapped anew.
+        os::numa_make_local(s, size, lgrp_id());
       }
       page_expected = page_found;
     }
@@ -55,6 +55,13 @@
           "limiter (a number between 0-100)")                               \
           range(0, 100)                                                     \
                                                                             \
+  product(uintx, ParallelOldMaxCompactedLivePercent, 100, EXPERIMENTAL,     \
+          "Upper limit on the live data moved by a full collection that "   \
+          "is not a maximum compaction, as a percentage of the old "        \
+          "generation capacity. Regions below the moved part are only "     \
+          "marked and updated")                                             \
+          range(1, 100)                                                     \
+                                                                            \
   develop(uintx, GCWorkerDelayMillis, 0,                                    \
           "Delay in scheduling GC workers (in milliseconds)")               \
                                                                             \
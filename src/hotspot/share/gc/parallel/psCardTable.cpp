@@ -32,6 +32,7 @@
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 
@@ -126,65 +127,57 @@ class CheckForPreciseMarks : public BasicOopIterateClosure {
 // when the space is empty, fix the calculation of
 // end_card to allow sp_top == sp->bottom().
 
-// The generation (old gen) is divided into slices, which are further
-// subdivided into stripes, with one stripe per GC thread. The size of
-// a stripe is a constant, ssize.
+// The generation (old gen) is divided into stripes of a constant size, ssize.
+// GC threads claim stripes dynamically from a shared counter until the top of
+// the generation is reached, so a thread that runs into a stripe with a lot
+// of work does not hold up the stripes behind it.
 //
-//      +===============+        slice 0
+//      +===============+
 //      |  stripe 0     |
 //      +---------------+
 //      |  stripe 1     |
 //      +---------------+
 //      |  stripe 2     |
 //      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 1
-//      |  stripe 0     |
-//      +---------------+
-//      |  stripe 1     |
-//      +---------------+
-//      |  stripe 2     |
-//      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 2
 //      ...
 //
-// In this case there are 4 threads, so 4 stripes.  A GC thread first works on
-// its stripe within slice 0 and then moves to its stripe in the next slice
-// until it has exceeded the top of the generation.  The distance to stripe in
-// the next slice is calculated based on the number of stripes.  The next
-// stripe is at ssize * number_of_stripes (= slice_stride)..  So after
-// finishing stripe 0 in slice 0, the thread finds the stripe 0 in slice1 by
-// adding slice_stride to the start of stripe 0 in slice 0 to get to the start
-// of stride 0 in slice 1.
+// An object belongs to the stripe that contains its header and is scanned by
+// the thread that claimed that stripe. Object arrays are the exception. They
+// are precisely card marked, so each stripe scans the dirty part of an object
+// array that is within the stripe and a large array is split across threads.
+
+// Object arrays are precisely card marked, only the part of an object array
+// that is covered by [start, end) needs to be scanned.
+static void scan_object(PSPromotionManager* pm, oop obj, HeapWord* start, HeapWord* end) {
+  if (obj->is_objArray()) {
+    pm->push_contents_bounded(obj, start, end);
+  } else {
+    pm->push_contents(obj);
+  }
+}
 
 void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
                                              MutableSpace* sp,
                                              HeapWord* space_top,
                                              PSPromotionManager* pm,
-                                             uint stripe_number,
-                                             uint stripe_total) {
-  int ssize = 128; // Naked constant!  Work unit = 64k.
-  int dirty_card_count = 0;
+                                             volatile size_t* claimed_stripes) {
+  const size_t ssize = 128; // Naked constant!  Work unit = 64k.
 
   // It is a waste to get here if empty.
   assert(sp->bottom() < sp->top(), "Should not be called if empty");
   oop* sp_top = (oop*)space_top;
   CardValue* start_card = byte_for(sp->bottom());
   CardValue* end_card   = byte_for(sp_top - 1) + 1;
-  oop* last_scanned = NULL; // Prevent scanning objects more than once
-  // The width of the stripe ssize*stripe_total must be
-  // consistent with the number of stripes so that the complete slice
-  // is covered.
-  size_t slice_width = ssize * stripe_total;
-  for (CardValue* slice = start_card; slice < end_card; slice += slice_width) {
-    CardValue* worker_start_card = slice + stripe_number * ssize;
-    if (worker_start_card >= end_card)
+  const size_t num_stripes = (pointer_delta(end_card, start_card, sizeof(CardValue)) + ssize - 1) / ssize;
+
+  while (true) {
+    const size_t stripe_index = Atomic::fetch_and_add(claimed_stripes, (size_t)1, memory_order_relaxed);
+    if (stripe_index >= num_stripes) {
       return; // We're done.
+    }
 
-    CardValue* worker_end_card = worker_start_card + ssize;
-    if (worker_end_card > end_card)
-      worker_end_card = end_card;
+    CardValue* worker_start_card = start_card + stripe_index * ssize;
+    CardValue* worker_end_card = MIN2(worker_start_card + ssize, end_card);
 
     // We do not want to scan objects more than once. In order to accomplish
     // this, we assert that any object with an object head inside our 'slice'
@@ -194,25 +187,28 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     // Note! ending cards are exclusive!
     HeapWord* slice_start = addr_for(worker_start_card);
     HeapWord* slice_end = MIN2((HeapWord*) sp_top, addr_for(worker_end_card));
+    oop* last_scanned = NULL; // Prevent scanning objects more than once
 
 #ifdef ASSERT
     if (GCWorkerDelayMillis > 0) {
-      // Delay 1 worker so that it proceeds after all the work
-      // has been completed.
-      if (stripe_number < 2) {
+      // Delay the first stripes so that they proceed after the
+      // other stripes have been completed.
+      if (stripe_index < 2) {
         os::naked_sleep(GCWorkerDelayMillis);
       }
     }
 #endif
 
-    // If there are not objects starting within the chunk, skip it.
-    if (!start_array->object_starts_in_range(slice_start, slice_end)) {
+    HeapWord* first_object = start_array->object_start(slice_start);
+    bool first_is_obj_array = first_object < slice_start && cast_to_oop(first_object)->is_objArray();
+    // If there are not objects starting within the chunk, and it does not
+    // cover part of an object array, skip it.
+    if (!first_is_obj_array && !start_array->object_starts_in_range(slice_start, slice_end)) {
       continue;
     }
     // Update our beginning addr
-    HeapWord* first_object = start_array->object_start(slice_start);
     debug_only(oop* first_object_within_slice = (oop*) first_object;)
-    if (first_object < slice_start) {
+    if (first_object < slice_start && !first_is_obj_array) {
       last_scanned = (oop*)(first_object + cast_to_oop(first_object)->size());
       debug_only(first_object_within_slice = last_scanned;)
       worker_start_card = byte_for(last_scanned);
@@ -222,13 +218,16 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     if (slice_end < (HeapWord*)sp_top) {
       // The subtraction is important! An object may start precisely at slice_end.
       HeapWord* last_object = start_array->object_start(slice_end - 1);
-      slice_end = last_object + cast_to_oop(last_object)->size();
-      // worker_end_card is exclusive, so bump it one past the end of last_object's
-      // covered span.
-      worker_end_card = byte_for(slice_end) + 1;
-
-      if (worker_end_card > end_card)
-        worker_end_card = end_card;
+      // The rest of an object array is scanned by the following stripes.
+      if (!cast_to_oop(last_object)->is_objArray()) {
+        slice_end = last_object + cast_to_oop(last_object)->size();
+        // worker_end_card is exclusive, so bump it one past the end of last_object's
+        // covered span.
+        worker_end_card = byte_for(slice_end) + 1;
+
+        if (worker_end_card > end_card)
+          worker_end_card = end_card;
+      }
     }
 
     assert(slice_end <= (HeapWord*)sp_top, "Last object in slice crosses space boundary");
@@ -260,22 +259,26 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
           // prevents the redundant object scan, but it does not prevent newly
           // marked cards from being cleaned.
           HeapWord* last_object_in_dirty_region = start_array->object_start(addr_for(current_card)-1);
-          size_t size_of_last_object = cast_to_oop(last_object_in_dirty_region)->size();
-          HeapWord* end_of_last_object = last_object_in_dirty_region + size_of_last_object;
-          CardValue* ending_card_of_last_object = byte_for(end_of_last_object);
-          assert(ending_card_of_last_object <= worker_end_card, "ending_card_of_last_object is greater than worker_end_card");
-          if (ending_card_of_last_object > current_card) {
-            // This means the object spans the next complete card.
-            // We need to bump the current_card to ending_card_of_last_object
-            current_card = ending_card_of_last_object;
+          oop last_obj = cast_to_oop(last_object_in_dirty_region);
+          // Only the dirty cards of an object array need to be scanned.
+          if (!last_obj->is_objArray()) {
+            HeapWord* end_of_last_object = last_object_in_dirty_region + last_obj->size();
+            CardValue* ending_card_of_last_object = byte_for(end_of_last_object);
+            assert(ending_card_of_last_object <= worker_end_card, "ending_card_of_last_object is greater than worker_end_card");
+            if (ending_card_of_last_object > current_card) {
+              // This means the object spans the next complete card.
+              // We need to bump the current_card to ending_card_of_last_object
+              current_card = ending_card_of_last_object;
+            }
           }
         }
       }
       CardValue* following_clean_card = current_card;
 
       if (first_unclean_card < worker_end_card) {
-        oop* p = (oop*) start_array->object_start(addr_for(first_unclean_card));
-        assert((HeapWord*)p <= addr_for(first_unclean_card), "checking");
+        HeapWord* dirty_start = addr_for(first_unclean_card);
+        oop* p = (oop*) start_array->object_start(dirty_start);
+        assert((HeapWord*)p <= dirty_start, "checking");
         // "p" should always be >= "last_scanned" because newly GC dirtied
         // cards are no longer scanned again (see comment at end
         // of loop on the increment of "current_card").  Test that
@@ -283,10 +286,14 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
         // If this code is removed, deal with the first time through
         // the loop when the last_scanned is the object starting in
         // the previous slice.
+        // An object array is only scanned within the dirty cards, so it may
+        // be visited again for the next run of dirty cards.
+        bool p_is_obj_array = cast_to_oop(p)->is_objArray();
         assert((p >= last_scanned) ||
-               (last_scanned == first_object_within_slice),
+               (last_scanned == first_object_within_slice) ||
+               p_is_obj_array,
                "Should no longer be possible");
-        if (p < last_scanned) {
+        if (p < last_scanned && !p_is_obj_array) {
           // Avoid scanning more than once; this can happen because
           // newgen cards set by GC may a different set than the
           // originally dirty set
@@ -318,7 +325,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
             Prefetch::write(p, interval);
             oop m = cast_to_oop(p);
             assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
-            pm->push_contents(m);
+            scan_object(pm, m, dirty_start, (HeapWord*)to);
             p += m->size();
           }
           pm->drain_stacks_cond_depth();
@@ -326,7 +333,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
           while (p < to) {
             oop m = cast_to_oop(p);
             assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
-            pm->push_contents(m);
+            scan_object(pm, m, dirty_start, (HeapWord*)to);
             p += m->size();
           }
           pm->drain_stacks_cond_depth();
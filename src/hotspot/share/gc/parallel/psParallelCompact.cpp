@@ -1431,6 +1431,25 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
     }
   }
 
+  // Bound the pause by moving the dense prefix to the right until the live
+  // data to be compacted is within the limit. The dead space to the left of
+  // the new dense prefix is kept until the next maximum compaction.
+  if (ParallelOldMaxCompactedLivePercent < 100) {
+    const size_t compacted_live_limit =
+      space_capacity / 100 * ParallelOldMaxCompactedLivePercent;
+    const RegionData* const orig_cp = best_cp;
+    while (best_cp + 1 < top_cp &&
+           pointer_delta(new_top, best_cp->destination()) > compacted_live_limit) {
+      ++best_cp;
+    }
+    if (best_cp != orig_cp) {
+      log_debug(gc, compaction)("Dense prefix moved from " PTR_FORMAT " to " PTR_FORMAT
+                                " to compact at most " SIZE_FORMAT " words",
+                                p2i(sd.region_to_addr(orig_cp)), p2i(sd.region_to_addr(best_cp)),
+                                compacted_live_limit);
+    }
+  }
+
   return sd.region_to_addr(best_cp);
 }
 
@@ -129,6 +129,11 @@ inline void PSPromotionManager::push_contents(oop obj) {
   }
 }
 
+inline void PSPromotionManager::push_contents_bounded(oop obj, HeapWord* left, HeapWord* right) {
+  PSPushContentsClosure pcc(this);
+  obj->oop_iterate(&pcc, MemRegion(left, right));
+}
+
 template<bool promote_immediately>
 inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
   assert(should_scavenge(&o), "Sanity");
@@ -249,6 +254,9 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
 
   assert(new_obj != NULL, "allocation should have succeeded");
 
+  // We're going to allocate linearly, so might as well prefetch ahead.
+  Prefetch::write(new_obj, PrefetchCopyIntervalInBytes);
+
   // Copy obj
   Copy::aligned_disjoint_words(cast_from_oop<HeapWord*>(o), cast_from_oop<HeapWord*>(new_obj), new_obj_size);
 
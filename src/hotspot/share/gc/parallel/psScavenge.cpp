@@ -287,6 +287,7 @@ class ScavengeRootsTask : public WorkerTask {
   uint _active_workers;
   bool _is_empty;
   TaskTerminator _terminator;
+  volatile size_t _claimed_stripes;
 
 public:
   ScavengeRootsTask(PSOldGen* old_gen,
@@ -300,7 +301,8 @@ public:
       _gen_top(gen_top),
       _active_workers(active_workers),
       _is_empty(is_empty),
-      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()) {
+      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()),
+      _claimed_stripes(0) {
   }
 
   virtual void work(uint worker_id) {
@@ -324,8 +326,7 @@ public:
                                                _old_gen->object_space(),
                                                _gen_top,
                                                pm,
-                                               worker_id,
-                                               _active_workers);
+                                               &_claimed_stripes);
 
         // Do the real work
         pm->drain_stacks(false);
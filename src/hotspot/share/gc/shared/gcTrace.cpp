@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/copyFailedInfo.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcId.hpp"
@@ -30,8 +31,10 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/objectCountEventSender.hpp"
 #include "gc/shared/referenceProcessorStats.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -100,8 +103,12 @@ void GCTracer::report_object_count_after_gc(BoolObjectClosure* is_alive_cl) {
 
     KlassInfoTable cit(false);
     if (!cit.allocation_failed()) {
+      // The GC workers are idle at this point of the pause, so use them
+      // if the GC supports parallel object iteration.
+      WorkerThreads* workers = Universe::heap()->safepoint_workers();
+      uint parallel_thread_num = (workers != NULL) ? workers->active_workers() : 1;
       HeapInspection hi;
-      hi.populate_table(&cit, is_alive_cl);
+      hi.populate_table(&cit, is_alive_cl, parallel_thread_num);
       ObjectCountEventSenderClosure event_sender(cit.size_of_instances_in_words(), Ticks::now());
       cit.iterate(&event_sender);
     }
@@ -29,6 +29,8 @@
 #include "logging/logStream.hpp"
 #include "memory/universe.hpp"
 #include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vmThread.hpp"
 
 void GCTraceTimeLoggerImpl::log_start(Ticks start) {
   _start = start;
@@ -70,11 +72,41 @@ void GCTraceTimeLoggerImpl::log_end(Ticks end) {
   out.print_cr(" %.3fms", duration_in_ms);
 }
 
+// Sums the CPU time consumed so far by the GC worker and concurrent threads
+// and by the VM thread, which runs the serial parts of the pauses.
+class GCThreadsCPUTimeClosure : public ThreadClosure {
+  jlong _total;
+public:
+  GCThreadsCPUTimeClosure() : _total(0) {}
+
+  virtual void do_thread(Thread* thread) {
+    if (thread->osthread() != NULL) {
+      jlong cpu_time = os::thread_cpu_time(thread);
+      if (cpu_time > 0) {
+        _total += cpu_time;
+      }
+    }
+  }
+
+  jlong total() const { return _total; }
+};
+
+static jlong gc_threads_cpu_time() {
+  if (!log_is_enabled(Debug, gc, cpu) || !os::is_thread_cpu_time_supported()) {
+    return -1;
+  }
+  GCThreadsCPUTimeClosure cl;
+  Universe::heap()->gc_threads_do(&cl);
+  cl.do_thread(VMThread::vm_thread());
+  return cl.total();
+}
+
 GCTraceCPUTime::GCTraceCPUTime() :
   _active(log_is_enabled(Info, gc, cpu)),
   _starting_user_time(0.0),
   _starting_system_time(0.0),
-  _starting_real_time(0.0)
+  _starting_real_time(0.0),
+  _starting_gc_threads_cpu_time(-1)
 {
   if (_active) {
     bool valid = os::getTimesSecs(&_starting_real_time,
@@ -83,6 +115,8 @@ GCTraceCPUTime::GCTraceCPUTime() :
     if (!valid) {
       log_warning(gc, cpu)("TraceCPUTime: os::getTimesSecs() returned invalid result");
       _active = false;
+    } else {
+      _starting_gc_threads_cpu_time = gc_threads_cpu_time();
     }
   }
 }
@@ -96,6 +130,10 @@ GCTraceCPUTime::~GCTraceCPUTime() {
                         user_time - _starting_user_time,
                         system_time - _starting_system_time,
                         real_time - _starting_real_time);
+      if (_starting_gc_threads_cpu_time >= 0) {
+        jlong gc_threads_time = gc_threads_cpu_time() - _starting_gc_threads_cpu_time;
+        log_debug(gc, cpu)("GC Threads=%3.2fs", (double)gc_threads_time / NANOSECS_PER_SEC);
+      }
     } else {
       log_warning(gc, cpu)("TraceCPUTime: os::getTimesSecs() returned invalid result");
     }
@@ -37,6 +37,7 @@ class GCTraceCPUTime : public StackObj {
   double _starting_user_time;   // user time at start of measurement
   double _starting_system_time; // system time at start of measurement
   double _starting_real_time;   // real time at start of measurement
+  jlong _starting_gc_threads_cpu_time; // CPU time of GC threads at start, or -1 if not measured
  public:
   GCTraceCPUTime();
   ~GCTraceCPUTime();
@@ -278,6 +278,12 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(uint, WorkStealingBatchSize, 16, EXPERIMENTAL,                   \
+          "Maximum number of tasks taken from a victim queue by one "       \
+          "successful steal. At most half of the tasks sampled in the "     \
+          "victim are taken; 1 disables batch stealing")                    \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
@@ -52,15 +52,6 @@ void PreservedMarks::adjust_during_full_gc() {
   }
 }
 
-void PreservedMarks::restore_and_increment(volatile size_t* const total_size_addr) {
-  const size_t stack_size = size();
-  restore();
-  // Only do the atomic add if the size is > 0.
-  if (stack_size > 0) {
-    Atomic::add(total_size_addr, stack_size);
-  }
-}
-
 #ifndef PRODUCT
 void PreservedMarks::assert_empty() {
   assert(_stack.is_empty(), "stack expected to be empty, size = " SIZE_FORMAT,
@@ -93,9 +84,21 @@ void PreservedMarksSet::init(uint num) {
   assert_empty();
 }
 
+// Workers claim the segments of all stacks instead of whole stacks, so that
+// a single large stack, e.g. from a worker that hit many evacuation failures,
+// is restored by all workers.
 class RestorePreservedMarksTask : public WorkerTask {
+  typedef PreservedMarks::OopAndMarkWord OopAndMarkWord;
+
+  struct Segment {
+    const OopAndMarkWord* _elems;
+    size_t _size;
+  };
+
   PreservedMarksSet* const _preserved_marks_set;
-  SequentialSubTasksDone _sub_tasks;
+  Segment* _segments;
+  size_t _num_segments;
+  volatile size_t _claimed_segments;
   volatile size_t _total_size;
 #ifdef ASSERT
   size_t _total_size_before;
@@ -103,30 +106,59 @@ class RestorePreservedMarksTask : public WorkerTask {
 
 public:
   void work(uint worker_id) override {
-    uint task_id = 0;
-    while (_sub_tasks.try_claim_task(task_id)) {
-      _preserved_marks_set->get(task_id)->restore_and_increment(&_total_size);
+    size_t restored = 0;
+    size_t i;
+    while ((i = Atomic::fetch_and_add(&_claimed_segments, (size_t)1)) < _num_segments) {
+      const Segment& seg = _segments[i];
+      for (size_t j = 0; j < seg._size; j++) {
+        seg._elems[j].set_mark();
+      }
+      restored += seg._size;
+    }
+    // Only do the atomic add if the size is > 0.
+    if (restored > 0) {
+      Atomic::add(&_total_size, restored);
     }
   }
 
   RestorePreservedMarksTask(PreservedMarksSet* preserved_marks_set)
     : WorkerTask("Restore Preserved Marks"),
       _preserved_marks_set(preserved_marks_set),
-      _sub_tasks(preserved_marks_set->num()),
+      _segments(nullptr),
+      _num_segments(0),
+      _claimed_segments(0),
       _total_size(0)
       DEBUG_ONLY(COMMA _total_size_before(0)) {
-#ifdef ASSERT
-    // This is to make sure the total_size we'll calculate below is correct.
+    size_t max_segments = 0;
     for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
-      _total_size_before += _preserved_marks_set->get(i)->size();
+      const PreservedMarks::OopAndMarkWordStack& stack = _preserved_marks_set->get(i)->_stack;
+      max_segments += (stack.size() + stack.segment_size() - 1) / stack.segment_size();
+      DEBUG_ONLY(_total_size_before += stack.size();)
+    }
+    if (max_segments == 0) {
+      return;
+    }
+    _segments = NEW_C_HEAP_ARRAY(Segment, max_segments, mtGC);
+    for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+      StackIterator<OopAndMarkWord, mtGC> iter(_preserved_marks_set->get(i)->_stack);
+      while (!iter.is_empty()) {
+        assert(_num_segments < max_segments, "must be");
+        Segment& seg = _segments[_num_segments++];
+        seg._elems = iter.next_segment(seg._size);
+      }
     }
-#endif // ASSERT
   }
 
   ~RestorePreservedMarksTask() {
     assert(_total_size == _total_size_before, "total_size = %zu before = %zu", _total_size, _total_size_before);
 
     log_trace(gc)("Restored %zu marks", _total_size);
+
+    // Release the stack segments now that all marks have been restored.
+    for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+      _preserved_marks_set->get(i)->_stack.clear(true /* clear_cache */);
+    }
+    FREE_C_HEAP_ARRAY(Segment, _segments);
   }
 };
 
@@ -35,6 +35,7 @@ class PreservedMarksSet;
 class WorkerThreads;
 
 class PreservedMarks {
+  friend class RestorePreservedMarksTask;
 private:
   class OopAndMarkWord {
   private:
@@ -65,7 +66,6 @@ public:
   // to their forwarding location stored in the mark.
   void adjust_during_full_gc();
 
-  void restore_and_increment(volatile size_t* const _total_size_addr);
   inline static void init_forwarded_mark(oop obj);
 
   // Assert the stack is empty and has no cached segments.
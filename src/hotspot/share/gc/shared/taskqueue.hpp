@@ -452,6 +452,9 @@ private:
   uint _n;
   T** _queues;
 
+  // Steal a task from queue victim_num into t, taking further tasks into
+  // queue_num's queue based on the sampled victim_size.
+  bool steal_from(uint queue_num, uint victim_num, uint victim_size, E& t);
   bool steal_best_of_2(uint queue_num, E& t);
 
 public:
@@ -30,6 +30,7 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/stack.inline.hpp"
@@ -267,6 +268,38 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+template<class T, MEMFLAGS F> bool
+GenericTaskQueueSet<T, F>::steal_from(uint queue_num, uint victim_num, uint victim_size, E& t) {
+  T* const victim = _queues[victim_num];
+  if (!victim->pop_global(t)) {
+    return false;
+  }
+
+  // Move up to half of the tasks seen in the victim into the local queue,
+  // so that a heavily loaded queue is split in one go instead of every
+  // thief coming back for a single task. The extra tasks are taken with
+  // the regular pop_global protocol, one at a time, and become stealable
+  // from the local queue again.
+  T* const local_queue = _queues[queue_num];
+  uint batch = MIN2(victim_size / 2, WorkStealingBatchSize);
+  for (uint i = 1; i < batch; i++) {
+    // Only the owner pushes to the local queue, and thieves can only make it
+    // smaller, so if there is room now the push below cannot fail.
+    if (local_queue->size() >= local_queue->max_elems()) {
+      break;
+    }
+    E task;
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_attempt());
+    if (!victim->pop_global(task)) {
+      break;
+    }
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal());
+    bool pushed = local_queue->push(task);
+    assert(pushed, "must have room in the local queue");
+  }
+  return true;
+}
+
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   if (_n > 2) {
@@ -295,10 +328,10 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
 
     if (sz2 > sz1) {
       sel_k = k2;
-      suc = _queues[k2]->pop_global(t);
+      suc = steal_from(queue_num, k2, sz2, t);
     } else if (sz1 > 0) {
       sel_k = k1;
-      suc = _queues[k1]->pop_global(t);
+      suc = steal_from(queue_num, k1, sz1, t);
     }
 
     if (suc) {
@@ -311,7 +344,7 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   } else if (_n == 2) {
     // Just try the other one.
     uint k = (queue_num + 1) % 2;
-    return _queues[k]->pop_global(t);
+    return steal_from(queue_num, k, _queues[k]->size(), t);
   } else {
     assert(_n == 1, "can't be zero.");
     return false;
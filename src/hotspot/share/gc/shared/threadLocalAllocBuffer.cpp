@@ -27,6 +27,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -85,23 +86,26 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
-  if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
-
-    if (update_allocation_history) {
-      // Average the fraction of eden allocated in a tlab by this
-      // thread for use in the next resize operation.
-      // _gc_waste is not subtracted because it's included in
-      // "used".
-      // The result can be larger than 1.0 due to direct to old allocations.
-      // These allocations should ideally not be counted but since it is not possible
-      // to filter them out here we just cap the fraction to be at most 1.0.
-      // Keep alloc_frac as float and not double to avoid the double to float conversion
-      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
-      _allocation_fraction.sample(alloc_frac);
-    }
+  // Update allocation history if a reasonable amount of eden was allocated.
+  // With TLABShrinkIdleThreads threads without refills are sampled too, so
+  // the TLABs of threads that stopped allocating shrink.
+  bool update_allocation_history = used > 0.5 * capacity &&
+                                   (_number_of_refills > 0 || TLABShrinkIdleThreads);
+
+  if (update_allocation_history) {
+    // Average the fraction of eden allocated in a tlab by this
+    // thread for use in the next resize operation.
+    // _gc_waste is not subtracted because it's included in
+    // "used".
+    // The result can be larger than 1.0 due to direct to old allocations.
+    // These allocations should ideally not be counted but since it is not possible
+    // to filter them out here we just cap the fraction to be at most 1.0.
+    // Keep alloc_frac as float and not double to avoid the double to float conversion
+    float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+    _allocation_fraction.sample(alloc_frac);
+  }
 
+  if (_number_of_refills > 0) {
     stats->update_fast_allocations(_number_of_refills,
                                    _allocated_size,
                                    _gc_waste,
@@ -468,6 +472,18 @@ void ThreadLocalAllocStats::publish() {
     _perf_total_slow_allocations  ->set_value(_total_slow_allocations);
     _perf_max_slow_allocations    ->set_value(_max_slow_allocations);
   }
+
+  EventTLABStatistics event;
+  if (event.should_commit()) {
+    event.set_allocatingThreads(_allocating_threads);
+    event.set_refills(_total_refills);
+    event.set_maxRefills(_max_refills);
+    event.set_allocated(_total_allocations * HeapWordSize);
+    event.set_gcWaste(_total_gc_waste * HeapWordSize);
+    event.set_refillWaste(_total_refill_waste * HeapWordSize);
+    event.set_slowAllocations(_total_slow_allocations);
+    event.commit();
+  }
 }
 
 size_t ThreadLocalAllocBuffer::end_reserve() {
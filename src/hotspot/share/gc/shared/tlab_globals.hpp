@@ -70,6 +70,10 @@
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, TLABShrinkIdleThreads, false, EXPERIMENTAL,                 \
+          "Also update the allocation history of threads that did not "     \
+          "refill their TLAB since the last GC, so their TLABs shrink")     \
+                                                                            \
   /* Limit the lower bound of this flag to 1 as it is used  */              \
   /* in a division expression.                              */              \
   product(uintx, TLABWasteTargetPercent, 1,                                 \
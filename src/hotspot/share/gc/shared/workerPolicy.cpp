@@ -119,7 +119,12 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   uintx max_active_workers =
     MAX2(active_workers_by_JT, active_workers_by_heap_size);
 
-  new_active_workers = MIN2(max_active_workers, (uintx) total_workers);
+  // Use fewer GC threads if the VM has lost processors since startup, so
+  // that GC leaves CPU to the application.
+  uintx active_workers_by_cpus =
+    MAX2(min_workers, (uintx) os::scale_by_active_processors(total_workers));
+
+  new_active_workers = MIN3(max_active_workers, active_workers_by_cpus, (uintx) total_workers);
 
   // Increase GC workers instantly but decrease them more
   // slowly.
@@ -136,9 +141,10 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   log_trace(gc, task)("WorkerPolicy::calc_default_active_workers() : "
     "active_workers(): " UINTX_FORMAT "  new_active_workers: " UINTX_FORMAT "  "
     "prev_active_workers: " UINTX_FORMAT "\n"
-    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT,
+    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT
+    "  active_workers_by_cpus: " UINTX_FORMAT,
     active_workers, new_active_workers, prev_active_workers,
-    active_workers_by_JT, active_workers_by_heap_size);
+    active_workers_by_JT, active_workers_by_heap_size, active_workers_by_cpus);
   assert(new_active_workers > 0, "Always need at least 1");
   return new_active_workers;
 }
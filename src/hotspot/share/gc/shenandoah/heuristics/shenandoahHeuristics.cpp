@@ -92,6 +92,10 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
   size_t free = 0;
   size_t free_regions = 0;
 
+  // Live data in regions allocated since the previous cycle, and in older regions
+  size_t young_live = 0;
+  size_t old_live = 0;
+
   ShenandoahMarkingContext* const ctx = heap->complete_marking_context();
 
   for (size_t i = 0; i < num_regions; i++) {
@@ -100,6 +104,14 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
     size_t garbage = region->garbage();
     total_garbage += garbage;
 
+    if (region->is_active()) {
+      if (region->age() <= 1) {
+        young_live += region->get_live_data_bytes();
+      } else {
+        old_live += region->get_live_data_bytes();
+      }
+    }
+
     if (region->is_empty()) {
       free_regions++;
       free += ShenandoahHeapRegion::region_size_bytes();
@@ -172,6 +184,10 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
                      byte_size_in_proper_unit(collection_set->garbage()),
                      proper_unit_for_byte_size(collection_set->garbage()),
                      cset_percent);
+
+  log_debug(gc, ergo)("Live Data by Region Age: Young: " SIZE_FORMAT "%s, Old: " SIZE_FORMAT "%s",
+                      byte_size_in_proper_unit(young_live), proper_unit_for_byte_size(young_live),
+                      byte_size_in_proper_unit(old_live),   proper_unit_for_byte_size(old_live));
 }
 
 void ShenandoahHeuristics::record_cycle_start() {
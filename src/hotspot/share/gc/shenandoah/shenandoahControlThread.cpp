@@ -470,6 +470,12 @@ void ShenandoahControlThread::service_uncommit(double shrink_before, size_t shri
 }
 
 bool ShenandoahControlThread::is_explicit_gc(GCCause::Cause cause) const {
+  // The heap dumper collects before the dump operation instead of inside it,
+  // so its cycle must not be dropped by DisableExplicitGC, like the white box
+  // full GC.
+  if (cause == GCCause::_heap_dump) {
+    return false;
+  }
   return GCCause::is_user_requested_gc(cause) ||
          GCCause::is_serviceability_requested_gc(cause);
 }
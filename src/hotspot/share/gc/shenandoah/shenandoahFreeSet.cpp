@@ -61,6 +61,16 @@ bool ShenandoahFreeSet::is_collector_free(size_t idx) const {
   return _collector_free_bitmap.at(idx);
 }
 
+size_t ShenandoahFreeSet::next_mutator_free(size_t idx, size_t end) const {
+  assert(end <= _max, "end is sane: " SIZE_FORMAT " <= " SIZE_FORMAT, end, _max);
+  return (idx < end) ? _mutator_free_bitmap.get_next_one_offset(idx, end) : end;
+}
+
+size_t ShenandoahFreeSet::next_collector_free(size_t idx, size_t end) const {
+  assert(end <= _max, "end is sane: " SIZE_FORMAT " <= " SIZE_FORMAT, end, _max);
+  return (idx < end) ? _collector_free_bitmap.get_next_one_offset(idx, end) : end;
+}
+
 HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool& in_new_region) {
   // Scan the bitmap looking for a first fit.
   //
@@ -78,13 +88,15 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
-      // Try to allocate in the mutator view
-      for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
-        if (is_mutator_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != NULL) {
-            return result;
-          }
+      // Try to allocate in the mutator view, skipping over non-free regions
+      // with bitmap searches
+      size_t const end = _mutator_rightmost + 1;
+      for (size_t idx = next_mutator_free(_mutator_leftmost, end);
+           idx < end;
+           idx = next_mutator_free(idx + 1, end)) {
+        HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+        if (result != NULL) {
+          return result;
         }
       }
 
@@ -227,16 +239,12 @@ void ShenandoahFreeSet::recompute_bounds() {
 
 void ShenandoahFreeSet::adjust_bounds() {
   // Rewind both mutator bounds until the next bit.
-  while (_mutator_leftmost < _max && !is_mutator_free(_mutator_leftmost)) {
-    _mutator_leftmost++;
-  }
+  _mutator_leftmost = next_mutator_free(_mutator_leftmost, _max);
   while (_mutator_rightmost > 0 && !is_mutator_free(_mutator_rightmost)) {
     _mutator_rightmost--;
   }
   // Rewind both collector bounds until the next bit.
-  while (_collector_leftmost < _max && !is_collector_free(_collector_leftmost)) {
-    _collector_leftmost++;
-  }
+  _collector_leftmost = next_collector_free(_collector_leftmost, _max);
   while (_collector_rightmost > 0 && !is_collector_free(_collector_rightmost)) {
     _collector_rightmost--;
   }
@@ -265,9 +273,16 @@ HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
       return NULL;
     }
 
-    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward.
+    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward
+    // to the next free region.
+    if (!is_mutator_free(end)) {
+      end = next_mutator_free(end + 1, _max);
+      beg = end;
+      continue;
+    }
+
     // If region is not completely free, the current [beg; end] is useless, and we may fast-forward.
-    if (!is_mutator_free(end) || !can_allocate_from(_heap->get_region(end))) {
+    if (!can_allocate_from(_heap->get_region(end))) {
       end++;
       beg = end;
       continue;
@@ -48,6 +48,11 @@ private:
   bool is_mutator_free(size_t idx) const;
   bool is_collector_free(size_t idx) const;
 
+  // Return the index of the first mutator (collector) free region in [idx, end),
+  // or end if there is none.
+  size_t next_mutator_free(size_t idx, size_t end) const;
+  size_t next_collector_free(size_t idx, size_t end) const;
+
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
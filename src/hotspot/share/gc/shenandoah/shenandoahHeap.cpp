@@ -1552,6 +1552,7 @@ public:
 class ShenandoahRendezvousClosure : public HandshakeClosure {
 public:
   inline ShenandoahRendezvousClosure() : HandshakeClosure("ShenandoahRendezvous") {}
+  inline bool is_parallel_safe() { return true; }
   inline void do_thread(Thread* thread) {}
 };
 
@@ -1626,6 +1627,9 @@ public:
       // Remember limit for updating refs. It's guaranteed that we get no
       // from-space-refs written from here on.
       r->set_update_watermark_at_safepoint(r->top());
+
+      // Region survived another marking cycle.
+      r->increment_age();
     } else {
       assert(!r->has_live(), "Region " SIZE_FORMAT " should have no live data", r->index());
       assert(_ctx->top_at_mark_start(r) == r->top(),
@@ -234,6 +234,7 @@ private:
 
   // Seldom updated fields
   RegionState _state;
+  uint _age;
 
   // Frequently updated fields
   HeapWord* _top;
@@ -251,6 +252,9 @@ public:
 
   static const size_t MIN_NUM_REGIONS = 10;
 
+  // Regions older than this are not distinguished any further
+  static const uint MAX_AGE = 15;
+
   // Return adjusted max heap size
   static size_t setup_sizes(size_t max_heap_size);
 
@@ -352,6 +356,11 @@ public:
 
   inline size_t garbage() const;
 
+  // Number of marking cycles this region has survived since it was last recycled
+  uint age() const              { return _age; }
+  void increment_age()          { if (_age < MAX_AGE) _age++; }
+  void reset_age()              { _age = 0; }
+
   void print_on(outputStream* st) const;
 
   void recycle();
@@ -28,6 +28,8 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadSMR.hpp"
@@ -182,6 +184,7 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_max_thread_alloc_words, (size_t)0);
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -222,9 +225,34 @@ intptr_t ShenandoahPacer::epoch() {
   return Atomic::load(&_epoch);
 }
 
+size_t ShenandoahPacer::max_delay_for(JavaThread* thread, size_t words) {
+  size_t max_ms = ShenandoahPacingMaxDelay;
+  if (!ShenandoahPacingFairness) {
+    return max_ms;
+  }
+
+  // Charge the delay proportionally to how much this thread allocated in
+  // the current phase, compared to the thread that allocated the most.
+  size_t thread_words = ShenandoahThreadLocalData::add_paced_alloc_words(thread, epoch(), words);
+  size_t max_words = Atomic::load(&_max_thread_alloc_words);
+  while (thread_words > max_words) {
+    size_t prev = Atomic::cmpxchg(&_max_thread_alloc_words, max_words, thread_words, memory_order_relaxed);
+    if (prev == max_words) {
+      max_words = thread_words;
+      break;
+    }
+    max_words = prev;
+  }
+
+  return MAX2<size_t>(1, (size_t)((double)max_ms * thread_words / max_words));
+}
+
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  JavaThread* const current = JavaThread::current();
+  size_t max_ms = max_delay_for(current, words);
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc(words, false);
   if (claimed) {
@@ -241,13 +269,13 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Threads that are attaching should not block at all: they are not
   // fully initialized yet. Blocking them would be awkward.
   // This is probably the path that allocates the thread oop itself.
-  if (JavaThread::current()->is_attaching_via_jni()) {
+  if (current->is_attaching_via_jni()) {
     return;
   }
 
+  EventShenandoahPacingStall event;
   double start = os::elapsedTime();
 
-  size_t max_ms = ShenandoahPacingMaxDelay;
   size_t total_ms = 0;
 
   while (true) {
@@ -264,7 +292,8 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       //     Breaking out and allocating anyway, which may mean we outpace GC,
       //     and start Degenerated GC cycle.
       //  b) The budget had been replenished, which means our claim is satisfied.
-      ShenandoahThreadLocalData::add_paced_time(JavaThread::current(), end - start);
+      ShenandoahThreadLocalData::add_paced_time(current, end - start);
+      event.commit(words * HeapWordSize);
       break;
     }
   }
@@ -62,6 +62,10 @@ private:
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Largest amount of words allocated by a single thread in this phase,
+  // used for ShenandoahPacingFairness
+  volatile size_t _max_thread_alloc_words;
+
 public:
   ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -71,7 +75,8 @@ public:
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {}
+          _progress(PACING_PROGRESS_UNINIT),
+          _max_thread_alloc_words(0) {}
 
   void setup_for_idle();
   void setup_for_mark();
@@ -106,6 +111,8 @@ private:
 
   size_t update_and_get_progress_history();
 
+  size_t max_delay_for(JavaThread* thread, size_t words);
+
   void wait(size_t time_ms);
 };
 
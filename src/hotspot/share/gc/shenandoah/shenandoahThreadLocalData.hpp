@@ -50,6 +50,8 @@ private:
   uint  _worker_id;
   int  _disarmed_value;
   double _paced_time;
+  intptr_t _paced_alloc_epoch;
+  size_t _paced_alloc_words;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -60,7 +62,9 @@ private:
     _gclab_size(0),
     _worker_id(INVALID_WORKER_ID),
     _disarmed_value(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _paced_alloc_epoch(0),
+    _paced_alloc_words(0) {
 
     // At least on x86_64, nmethod entry barrier encodes _disarmed_value offset
     // in instruction as disp8 immed
@@ -144,6 +148,18 @@ public:
     data(thread)->_paced_time = 0;
   }
 
+  // Records words allocated by the thread in the given pacing epoch, and
+  // returns the total allocated by the thread in that epoch.
+  static size_t add_paced_alloc_words(Thread* thread, intptr_t epoch, size_t words) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    if (d->_paced_alloc_epoch != epoch) {
+      d->_paced_alloc_epoch = epoch;
+      d->_paced_alloc_words = 0;
+    }
+    d->_paced_alloc_words += words;
+    return d->_paced_alloc_words;
+  }
+
   static void set_disarmed_value(Thread* thread, int value) {
     data(thread)->_disarmed_value = value;
   }
@@ -255,6 +255,12 @@
           "GC effectively stall the threads indefinitely instead of going " \
           "to degenerated or Full GC.")                                     \
                                                                             \
+  product(bool, ShenandoahPacingFairness, false, EXPERIMENTAL,              \
+          "Scale the pacing delay of each thread by how much it allocated " \
+          "in the current pacing phase, relative to the thread that "       \
+          "allocated the most. Threads that allocate rarely are then "      \
+          "stalled for much less than ShenandoahPacingMaxDelay.")           \
+                                                                            \
   product(uintx, ShenandoahPacingIdleSlack, 2, EXPERIMENTAL,                \
           "How much of heap counted as non-taxable allocations during idle "\
           "phases. Larger value makes the pacing milder when collector is " \
@@ -32,6 +32,17 @@
 
 constexpr double one_in_1000 = 3.290527;
 constexpr double sample_interval = 1.0 / ZStatAllocRate::sample_hz;
+constexpr double max_alloc_stall_factor = 4.0;
+
+// Allocation stall feedback. An allocation stall means the allocation rate
+// rule started the GC cycle too late, so each GC cycle during which a stall
+// is observed doubles the allocation spike tolerance used by the rule. Each
+// GC cycle completed without stalls decays it back towards the configured
+// ZAllocationSpikeTolerance, to not keep spending GC CPU time once the
+// allocation behavior has calmed down.
+static double   alloc_stall_factor = 1.0;
+static uint64_t alloc_stall_cycle = 0;
+static bool     alloc_stall_observed = false;
 
 ZDirector::ZDirector(ZDriver* driver) :
     _driver(driver),
@@ -52,6 +63,29 @@ static void sample_allocation_rate() {
                        ZStatAllocRate::sd() / M);
 }
 
+static double alloc_spike_tolerance() {
+  return ZAllocationSpikeTolerance * alloc_stall_factor;
+}
+
+static void update_alloc_stall_factor() {
+  const uint64_t ncycles = ZStatCycle::ncycles();
+  if (ncycles != alloc_stall_cycle) {
+    // A new GC cycle has started, which also resets the stall
+    // statistics of the page allocator.
+    if (!alloc_stall_observed) {
+      alloc_stall_factor = MAX2(alloc_stall_factor * 0.75, 1.0);
+    }
+    alloc_stall_cycle = ncycles;
+    alloc_stall_observed = false;
+  }
+
+  if (!alloc_stall_observed && ZHeap::heap()->has_alloc_stalled()) {
+    alloc_stall_observed = true;
+    alloc_stall_factor = MIN2(alloc_stall_factor * 2.0, max_alloc_stall_factor);
+    log_debug(gc, director)("Allocation Stall Feedback, SpikeTolerance: %.2f", alloc_spike_tolerance());
+  }
+}
+
 static ZDriverRequest rule_allocation_stall() {
   // Perform GC if we've observed at least one allocation stall since
   // the last GC started.
@@ -191,7 +225,7 @@ ZDriverRequest rule_allocation_rate_dynamic() {
   const double alloc_rate_avg = ZStatAllocRate::avg();
   const double alloc_rate_sd = ZStatAllocRate::sd();
   const double alloc_rate_sd_percent = alloc_rate_sd / (alloc_rate_avg + 1.0);
-  const double alloc_rate = (MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * one_in_1000) + 1.0;
+  const double alloc_rate = (MAX2(alloc_rate_predict, alloc_rate_avg) * alloc_spike_tolerance()) + (alloc_rate_sd * one_in_1000) + 1.0;
   const double time_until_oom = (free / alloc_rate) / (1.0 + alloc_rate_sd_percent);
 
   // Calculate max serial/parallel times of a GC cycle. The times are
@@ -259,7 +293,7 @@ static ZDriverRequest rule_allocation_rate_static() {
   // phase changes in the allocate rate. We then add ~3.3 sigma to account for
   // the allocation rate variance, which means the probability is 1 in 1000
   // that a sample is outside of the confidence interval.
-  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::sd() * one_in_1000);
+  const double max_alloc_rate = (ZStatAllocRate::avg() * alloc_spike_tolerance()) + (ZStatAllocRate::sd() * one_in_1000);
   const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
 
   // Calculate max serial/parallel times of a GC cycle. The times are
@@ -392,6 +426,7 @@ void ZDirector::run_service() {
   // Main loop
   while (_metronome.wait_for_tick()) {
     sample_allocation_rate();
+    update_alloc_stall_factor();
     if (!_driver->is_busy()) {
       const ZDriverRequest request = make_gc_decision();
       if (request.cause() != GCCause::_no_gc) {
@@ -228,6 +228,7 @@ void ZDriver::collect(const ZDriverRequest& request) {
   case GCCause::_full_gc_alot:
   case GCCause::_scavenge_alot:
   case GCCause::_jvmti_force_gc:
+  case GCCause::_heap_dump:
   case GCCause::_metadata_GC_clear_soft_refs:
     // Start synchronous GC
     _gc_cycle_port.send_sync(request);
@@ -67,6 +67,10 @@ inline uint8_t ZForwarding::type() const {
   return _page->type();
 }
 
+inline uint8_t ZForwarding::age() const {
+  return _page->age();
+}
+
 inline uintptr_t ZForwarding::start() const {
   return _virtual.start();
 }
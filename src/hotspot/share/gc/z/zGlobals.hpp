@@ -56,6 +56,9 @@ const uint8_t     ZPageTypeSmall                = 0;
 const uint8_t     ZPageTypeMedium               = 1;
 const uint8_t     ZPageTypeLarge                = 2;
 
+// Page age, i.e. the number of GC cycles the objects on a page have survived
+const uint8_t     ZPageAgeMax                   = 7;
+
 // Page size shifts
 const size_t      ZPageSizeSmallShift           = ZGranuleSizeShift;
 extern size_t     ZPageSizeMediumShift;
@@ -148,6 +151,9 @@ const size_t      ZMarkCacheSize                = 1024; // Must be a power of tw
 const size_t      ZMarkPartialArrayMinSizeShift = 12; // 4K
 const size_t      ZMarkPartialArrayMinSize      = (size_t)1 << ZMarkPartialArrayMinSizeShift;
 
+// Number of popped mark stack entries to prefetch ahead of following them
+const size_t      ZMarkPrefetchDistance         = 4;
+
 // Max number of proactive/terminate flush attempts
 const size_t      ZMarkProactiveFlushMax        = 10;
 const size_t      ZMarkTerminateFlushMax        = 3;
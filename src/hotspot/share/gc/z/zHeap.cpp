@@ -298,6 +298,8 @@ public:
   ZRendezvousClosure() :
       HandshakeClosure("ZRendezvous") {}
 
+  bool is_parallel_safe() { return true; }
+
   void do_thread(Thread* thread) {}
 };
 
@@ -351,18 +351,81 @@ void ZMark::mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry) {
   }
 }
 
+// Holds back a few popped mark stack entries, with a prefetch of their
+// object issued when they are added, so that following an entry does not
+// stall on a cache miss when reading the object.
+class ZMarkPrefetchQueue : public StackObj {
+private:
+  ZMarkStackEntry _entries[ZMarkPrefetchDistance];
+  size_t          _head;
+  size_t          _length;
+
+public:
+  ZMarkPrefetchQueue() :
+      _entries(),
+      _head(0),
+      _length(0) {}
+
+  bool is_empty() const {
+    return _length == 0;
+  }
+
+  // Adds the given entry. Returns true, and the next entry to follow in
+  // next, once the queue is full.
+  bool add(ZMarkStackEntry entry, ZMarkStackEntry& next) {
+    if (!entry.partial_array()) {
+      Prefetch::read((void*)entry.object_address(), 0);
+    }
+
+    if (_length < ZMarkPrefetchDistance) {
+      _entries[(_head + _length++) % ZMarkPrefetchDistance] = entry;
+      return false;
+    }
+
+    next = _entries[_head];
+    _entries[_head] = entry;
+    _head = (_head + 1) % ZMarkPrefetchDistance;
+    return true;
+  }
+
+  ZMarkStackEntry remove() {
+    assert(!is_empty(), "Queue is empty");
+    const ZMarkStackEntry entry = _entries[_head];
+    _head = (_head + 1) % ZMarkPrefetchDistance;
+    _length--;
+    return entry;
+  }
+};
+
 template <typename T>
 bool ZMark::drain(ZMarkContext* context, T* timeout) {
   ZMarkStripe* const stripe = context->stripe();
   ZMarkThreadLocalStacks* const stacks = context->stacks();
+  ZMarkPrefetchQueue queue;
   ZMarkStackEntry entry;
+  ZMarkStackEntry next;
 
   // Drain stripe stacks
-  while (stacks->pop(&_allocator, &_stripes, stripe, entry)) {
-    mark_and_follow(context, entry);
+  for (;;) {
+    if (stacks->pop(&_allocator, &_stripes, stripe, entry)) {
+      if (!queue.add(entry, next)) {
+        continue;
+      }
+    } else if (!queue.is_empty()) {
+      next = queue.remove();
+    } else {
+      break;
+    }
+
+    mark_and_follow(context, next);
 
     // Check timeout
     if (timeout->has_expired()) {
+      // Follow entries held back by the prefetch queue
+      while (!queue.is_empty()) {
+        mark_and_follow(context, queue.remove());
+      }
+
       // Timeout
       return false;
     }
@@ -37,6 +37,7 @@ class ZPage : public CHeapObj<mtGC> {
 private:
   uint8_t            _type;
   uint8_t            _numa_id;
+  uint8_t            _age;
   uint32_t           _seqnum;
   ZVirtualMemory     _virtual;
   volatile uintptr_t _top;
@@ -78,6 +79,9 @@ public:
   bool is_allocating() const;
   bool is_relocatable() const;
 
+  uint8_t age() const;
+  void set_age(uint8_t age);
+
   uint64_t last_used() const;
   void set_last_used();
 
@@ -153,6 +153,20 @@ inline bool ZPage::is_relocatable() const {
   return _seqnum < ZGlobalSeqNum;
 }
 
+inline uint8_t ZPage::age() const {
+  // Objects on a page age by one for each GC cycle started after the
+  // page was allocated. Pages allocated for relocation inherit the age
+  // of the page being relocated.
+  const uint32_t cycles = ZGlobalSeqNum - _seqnum;
+  return (uint8_t)MIN2<uint32_t>(_age + cycles, ZPageAgeMax);
+}
+
+inline void ZPage::set_age(uint8_t age) {
+  assert(is_allocating(), "Invalid page state");
+  assert(age <= ZPageAgeMax, "Invalid age");
+  _age = age;
+}
+
 inline uint64_t ZPage::last_used() const {
   return _last_used;
 }
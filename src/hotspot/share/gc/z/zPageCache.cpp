@@ -125,17 +125,27 @@ ZPage* ZPageCache::alloc_oversized_medium_page(size_t size) {
 }
 
 ZPage* ZPageCache::alloc_oversized_large_page(size_t size) {
-  // Find a page that is large enough
+  // Find the smallest page that is large enough. Splitting the page that
+  // wastes the least keeps larger pages intact for later large allocations,
+  // which would otherwise have to flush and remap the cache.
+  ZPage* best = NULL;
   ZListIterator<ZPage> iter(&_large);
   for (ZPage* page; iter.next(&page);) {
-    if (size <= page->size()) {
-      // Page found
-      _large.remove(page);
-      return page;
+    if (size <= page->size() && (best == NULL || page->size() < best->size())) {
+      best = page;
+      if (page->size() == size) {
+        // Exact fit, nothing can fit better
+        break;
+      }
     }
   }
 
-  return NULL;
+  if (best != NULL) {
+    // Page found
+    _large.remove(best);
+  }
+
+  return best;
 }
 
 ZPage* ZPageCache::alloc_oversized_page(size_t size) {
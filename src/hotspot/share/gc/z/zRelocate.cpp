@@ -135,7 +135,15 @@ static ZPage* alloc_page(const ZForwarding* forwarding) {
   ZAllocationFlags flags;
   flags.set_non_blocking();
   flags.set_worker_relocation();
-  return ZHeap::heap()->alloc_page(forwarding->type(), forwarding->size(), flags);
+  ZPage* const page = ZHeap::heap()->alloc_page(forwarding->type(), forwarding->size(), flags);
+  if (page != NULL) {
+    // Relocated objects keep their age. Objects from pages of different
+    // ages can share a target page, in which case the target page takes
+    // the age of the page that caused it to be allocated.
+    page->set_age(forwarding->age());
+  }
+
+  return page;
 }
 
 static void free_page(ZPage* page) {
@@ -40,6 +40,13 @@ ZRelocationSetSelectorGroupStats::ZRelocationSetSelectorGroupStats() :
     _empty(0),
     _relocate(0) {}
 
+ZRelocationSetSelectorAgeStats::ZRelocationSetSelectorAgeStats() {
+  for (uint8_t age = 0; age <= ZPageAgeMax; age++) {
+    _live[age] = 0;
+    _garbage[age] = 0;
+  }
+}
+
 ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
                                                          uint8_t page_type,
                                                          size_t page_size,
@@ -180,6 +187,7 @@ ZRelocationSetSelector::ZRelocationSetSelector() :
     _small("Small", ZPageTypeSmall, ZPageSizeSmall, ZObjectSizeLimitSmall),
     _medium("Medium", ZPageTypeMedium, ZPageSizeMedium, ZObjectSizeLimitMedium),
     _large("Large", ZPageTypeLarge, 0 /* page_size */, 0 /* object_size_limit */),
+    _age(),
     _empty_pages() {}
 
 void ZRelocationSetSelector::select() {
@@ -205,5 +213,6 @@ ZRelocationSetSelectorStats ZRelocationSetSelector::stats() const {
   stats._small = _small.stats();
   stats._medium = _medium.stats();
   stats._large = _large.stats();
+  stats._age = _age;
   return stats;
 }
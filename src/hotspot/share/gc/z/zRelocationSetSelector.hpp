@@ -25,6 +25,7 @@
 #define SHARE_GC_Z_ZRELOCATIONSETSELECTOR_HPP
 
 #include "gc/z/zArray.hpp"
+#include "gc/z/zGlobals.hpp"
 #include "memory/allocation.hpp"
 
 class ZPage;
@@ -49,6 +50,20 @@ public:
   size_t relocate() const;
 };
 
+class ZRelocationSetSelectorAgeStats {
+  friend class ZRelocationSetSelector;
+
+private:
+  size_t _live[ZPageAgeMax + 1];
+  size_t _garbage[ZPageAgeMax + 1];
+
+public:
+  ZRelocationSetSelectorAgeStats();
+
+  size_t live(uint8_t age) const;
+  size_t garbage(uint8_t age) const;
+};
+
 class ZRelocationSetSelectorStats {
   friend class ZRelocationSetSelector;
 
@@ -56,11 +71,13 @@ private:
   ZRelocationSetSelectorGroupStats _small;
   ZRelocationSetSelectorGroupStats _medium;
   ZRelocationSetSelectorGroupStats _large;
+  ZRelocationSetSelectorAgeStats   _age;
 
 public:
   const ZRelocationSetSelectorGroupStats& small() const;
   const ZRelocationSetSelectorGroupStats& medium() const;
   const ZRelocationSetSelectorGroupStats& large() const;
+  const ZRelocationSetSelectorAgeStats& age() const;
 };
 
 class ZRelocationSetSelectorGroup {
@@ -97,10 +114,11 @@ public:
 
 class ZRelocationSetSelector : public StackObj {
 private:
-  ZRelocationSetSelectorGroup _small;
-  ZRelocationSetSelectorGroup _medium;
-  ZRelocationSetSelectorGroup _large;
-  ZArray<ZPage*>              _empty_pages;
+  ZRelocationSetSelectorGroup    _small;
+  ZRelocationSetSelectorGroup    _medium;
+  ZRelocationSetSelectorGroup    _large;
+  ZRelocationSetSelectorAgeStats _age;
+  ZArray<ZPage*>                 _empty_pages;
 
   size_t total() const;
   size_t empty() const;
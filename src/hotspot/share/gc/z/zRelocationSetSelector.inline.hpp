@@ -49,6 +49,16 @@ inline size_t ZRelocationSetSelectorGroupStats::relocate() const {
   return _relocate;
 }
 
+inline size_t ZRelocationSetSelectorAgeStats::live(uint8_t age) const {
+  assert(age <= ZPageAgeMax, "Invalid age");
+  return _live[age];
+}
+
+inline size_t ZRelocationSetSelectorAgeStats::garbage(uint8_t age) const {
+  assert(age <= ZPageAgeMax, "Invalid age");
+  return _garbage[age];
+}
+
 inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::small() const {
   return _small;
 }
@@ -61,6 +71,10 @@ inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::larg
   return _large;
 }
 
+inline const ZRelocationSetSelectorAgeStats& ZRelocationSetSelectorStats::age() const {
+  return _age;
+}
+
 inline void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
   const uint8_t type = page->type();
   const size_t size = page->size();
@@ -106,6 +120,11 @@ inline void ZRelocationSetSelector::register_live_page(ZPage* page) {
   } else {
     _large.register_live_page(page);
   }
+
+  const uint8_t age = page->age();
+  const size_t live = page->live_bytes();
+  _age._live[age] += live;
+  _age._garbage[age] += page->size() - live;
 }
 
 inline void ZRelocationSetSelector::register_empty_page(ZPage* page) {
@@ -119,6 +138,7 @@ inline void ZRelocationSetSelector::register_empty_page(ZPage* page) {
     _large.register_empty_page(page);
   }
 
+  _age._garbage[page->age()] += page->size();
   _empty_pages.append(page);
 }
 
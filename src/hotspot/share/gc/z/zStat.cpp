@@ -1061,6 +1061,7 @@ public:
 //
 // Stat cycle
 //
+uint64_t  ZStatCycle::_ncycles = 0;
 uint64_t  ZStatCycle::_nwarmup_cycles = 0;
 Ticks     ZStatCycle::_start_of_last;
 Ticks     ZStatCycle::_end_of_last;
@@ -1070,6 +1071,7 @@ uint      ZStatCycle::_last_active_workers = 0;
 
 void ZStatCycle::at_start() {
   _start_of_last = Ticks::now();
+  _ncycles++;
 }
 
 void ZStatCycle::at_end(GCCause::Cause cause, uint active_workers) {
@@ -1090,6 +1092,10 @@ void ZStatCycle::at_end(GCCause::Cause cause, uint active_workers) {
   _parallelizable_time.add(parallelizable_time);
 }
 
+uint64_t ZStatCycle::ncycles() {
+  return _ncycles;
+}
+
 bool ZStatCycle::is_warm() {
   return _nwarmup_cycles >= 3;
 }
@@ -1244,6 +1250,15 @@ void ZStatRelocation::print() {
   }
   print("Large", _selector_stats.large(), 0 /* in_place_count */);
 
+  for (uint8_t age = 0; age <= ZPageAgeMax; age++) {
+    const size_t live = _selector_stats.age().live(age);
+    const size_t garbage = _selector_stats.age().garbage(age);
+    if (live != 0 || garbage != 0) {
+      log_debug(gc, reloc)("Age %u: Live: " SIZE_FORMAT "M, Garbage: " SIZE_FORMAT "M",
+                           age, live / M, garbage / M);
+    }
+  }
+
   log_info(gc, reloc)("Forwarding Usage: " SIZE_FORMAT "M", _forwarding_usage / M);
 }
 
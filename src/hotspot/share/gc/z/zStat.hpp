@@ -371,6 +371,7 @@ public:
 //
 class ZStatCycle : public AllStatic {
 private:
+  static uint64_t  _ncycles;
   static uint64_t  _nwarmup_cycles;
   static Ticks     _start_of_last;
   static Ticks     _end_of_last;
@@ -382,6 +383,7 @@ public:
   static void at_start();
   static void at_end(GCCause::Cause cause, uint active_workers);
 
+  static uint64_t ncycles();
   static bool is_warm();
   static uint64_t nwarmup_cycles();
 
@@ -366,6 +366,26 @@ static bool is_excluded(JavaThread* thread) {
   return thread->is_hidden_from_external_view() || thread->in_deopt_handler() || thread->jfr_thread_local()->is_excluded();
 }
 
+// A thread that is in Java but has not been on a CPU since the sampler last
+// looked at it would only produce a duplicate sample with the same stack.
+// Skip it without suspending it, so that the limited number of samples per
+// period goes to threads that are actually running.
+static bool has_run_since_last_sample(JavaThread* thread) {
+  if (!os::is_thread_cpu_time_supported()) {
+    return true;
+  }
+  const jlong cpu_time = os::thread_cpu_time(thread);
+  if (cpu_time == -1) {
+    return true;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  if (cpu_time == tl->get_sampled_cpu_time()) {
+    return false;
+  }
+  tl->set_sampled_cpu_time(cpu_time);
+  return true;
+}
+
 bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type) {
   assert(Threads_lock->owned_by_self(), "Holding the thread table lock.");
   if (is_excluded(thread)) {
@@ -375,7 +395,7 @@ bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame*
   bool ret = false;
   thread->set_trace_flag();  // Provides StoreLoad, needed to keep read of thread state from floating up.
   if (JAVA_SAMPLE == type) {
-    if (thread_state_in_java(thread)) {
+    if (thread_state_in_java(thread) && has_run_since_last_sample(thread)) {
       ret = sample_thread_in_java(thread, frames, max_frames);
     }
   } else {
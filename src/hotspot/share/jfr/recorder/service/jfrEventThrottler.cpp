@@ -36,6 +36,7 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                            };
 
 static JfrEventThrottler* _throttler = NULL;
+static JfrEventThrottler* _native_allocation_throttler = NULL;
 
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
@@ -49,29 +50,44 @@ JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
 
 bool JfrEventThrottler::create() {
   assert(_throttler == NULL, "invariant");
+  assert(_native_allocation_throttler == NULL, "invariant");
   _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != NULL && _throttler->initialize();
+  if (_throttler == NULL || !_throttler->initialize()) {
+    return false;
+  }
+  _native_allocation_throttler = new JfrEventThrottler(JfrNativeMemoryAllocationSampleEvent);
+  return _native_allocation_throttler != NULL && _native_allocation_throttler->initialize();
 }
 
 void JfrEventThrottler::destroy() {
   delete _throttler;
   _throttler = NULL;
+  delete _native_allocation_throttler;
+  _native_allocation_throttler = NULL;
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
+// There are throttler instances for the jdk.ObjectAllocationSample and
+// jdk.NativeMemoryAllocationSample events.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
   assert(_throttler != NULL, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : NULL;
+  switch (event_id) {
+    case JfrObjectAllocationSampleEvent:
+      return _throttler;
+    case JfrNativeMemoryAllocationSampleEvent:
+      return _native_allocation_throttler;
+    default:
+      assert(false, "Event type has an unconfigured throttler");
+      return NULL;
+  }
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if (event_id != JfrObjectAllocationSampleEvent && event_id != JfrNativeMemoryAllocationSampleEvent) {
     return;
   }
-  assert(_throttler != NULL, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  JfrEventThrottler* const throttler = for_event(event_id);
+  assert(throttler != NULL, "JfrEventThrottler has not been properly initialized");
+  throttler->configure(sample_size, period_ms);
 }
 
 /*
@@ -94,7 +110,7 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == NULL) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -240,16 +256,17 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
- *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static const char* event_name(JfrEventId event_id) {
+  return event_id == JfrNativeMemoryAllocationSampleEvent ? "jdk.NativeMemoryAllocationSample" : "jdk.ObjectAllocationSample";
+}
+
+static void log(const JfrSamplerWindow* expired, double* sample_size_ewma, JfrEventId event_id) {
   assert(sample_size_ewma != NULL, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(expired->sample_size(), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("%s: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      event_name(event_id), *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : (double)expired->sample_size() / (double)expired->population_size(),
       expired->params().window_duration_ms);
   }
@@ -268,7 +285,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != NULL, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(expired, &_sample_size_ewma, _event_id);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
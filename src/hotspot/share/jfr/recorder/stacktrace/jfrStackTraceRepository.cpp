@@ -28,13 +28,20 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Lookups of already known traces are lock free: readers walk the bucket chains inside
+ * a GlobalCounter critical section. Insertion publishes a new chain head under
+ * JfrStacktrace_lock, and entries are only deleted after they have been unlinked and
+ * all readers that might still see them have left their critical sections.
  */
 
 static JfrStackTraceRepository* _instance = NULL;
@@ -105,43 +112,50 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   assert(_entries > 0, "invariant");
   int count = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    const JfrStackTrace* stacktrace = _table[i];
     while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
+      stacktrace = stacktrace->next();
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+    delete_entries();
   }
   _last_entries = _entries;
   return count;
 }
 
-size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
+// Unlink all entries, wait for concurrent lock free readers, then delete.
+void JfrStackTraceRepository::delete_entries() {
+  assert(JfrStacktrace_lock->owned_by_self(), "invariant");
+  JfrStackTrace** const unlinked = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    unlinked[i] = _table[i];
+    Atomic::release_store(&_table[i], (JfrStackTrace*)NULL);
   }
+  GlobalCounter::write_synchronize();
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
+    JfrStackTrace* stacktrace = unlinked[i];
     while (stacktrace != NULL) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       delete stacktrace;
       stacktrace = next;
     }
   }
-  memset(repo._table, 0, sizeof(repo._table));
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, unlinked);
+  _entries = 0;
+}
+
+size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  if (repo._entries == 0) {
+    return 0;
+  }
   const size_t processed = repo._entries;
-  repo._entries = 0;
+  repo.delete_entries();
   repo._last_entries = 0;
   return processed;
 }
@@ -197,24 +211,40 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* thread, int s
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
+traceid JfrStackTraceRepository::find_trace(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace) {
   while (table_entry != NULL) {
     if (table_entry->equals(stacktrace)) {
       return table_entry->id();
     }
     table_entry = table_entry->next();
   }
+  return 0;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    // Most traces are already in the table; find them without the lock.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const traceid id = find_trace(Atomic::load_acquire(&_table[index]), stacktrace);
+    if (id != 0) {
+      return id;
+    }
+  }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  JfrStackTrace* const head = _table[index];
+  // Another thread may have added the trace since the lock free lookup.
+  traceid id = find_trace(head, stacktrace);
+  if (id != 0) {
+    return id;
+  }
+  id = ++_next_id;
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, head));
   ++_entries;
   return id;
 }
@@ -58,12 +58,14 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   bool is_modified() const;
   static size_t clear();
   static size_t clear(JfrStackTraceRepository& repo);
+  void delete_entries();
   size_t write(JfrChunkWriter& cw, bool clear);
 
   static const JfrStackTrace* lookup_for_leak_profiler(unsigned int hash, traceid id);
   static void record_for_leak_profiler(JavaThread* thread, int skip = 0);
   static void clear_leak_profiler();
 
+  static traceid find_trace(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace);
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
@@ -0,0 +1,48 @@
+/*
+* Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrNativeMemoryAllocationSample.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+void JfrNativeMemoryAllocationSample::send_event(const void* address, size_t size) {
+  if (address == NULL || !EventNativeMemoryAllocationSample::is_enabled()) {
+    return;
+  }
+  JfrThreadLocal* const tl = Thread::current()->jfr_thread_local();
+  const int64_t unsampled_bytes = tl->native_unsampled_bytes() + static_cast<int64_t>(size);
+  EventNativeMemoryAllocationSample event;
+  if (event.should_commit()) {
+    event.set_address(static_cast<u8>(p2i(address)));
+    event.set_size(size);
+    event.set_weight(unsampled_bytes);
+    event.commit();
+    tl->set_native_unsampled_bytes(0);
+  } else {
+    tl->set_native_unsampled_bytes(unsampled_bytes);
+  }
+}
@@ -0,0 +1,40 @@
+/*
+* Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#ifndef SHARE_JFR_SUPPORT_JFRNATIVEMEMORYALLOCATIONSAMPLE_HPP
+#define SHARE_JFR_SUPPORT_JFRNATIVEMEMORYALLOCATIONSAMPLE_HPP
+
+#include "memory/allocation.hpp"
+
+// Sends throttled jdk.NativeMemoryAllocationSample events for native memory
+// allocated on behalf of Java code. The weight of a sample is the sum of the
+// sizes passed since the thread's previous sample. A reallocated block counts
+// with its full new size, because the size it had before is not known. This
+// overstates the weight of call sites that grow blocks by reallocation.
+class JfrNativeMemoryAllocationSample : AllStatic {
+ public:
+  static void send_event(const void* address, size_t size);
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRNATIVEMEMORYALLOCATIONSAMPLE_HPP
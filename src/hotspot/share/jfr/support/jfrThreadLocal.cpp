@@ -53,6 +53,8 @@ JfrThreadLocal::JfrThreadLocal() :
   _user_time(0),
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
+  _sampled_cpu_time(0),
+  _native_unsampled_bytes(0),
   _stack_trace_hash(0),
   _stackdepth(0),
   _entering_suspend_flag(0),
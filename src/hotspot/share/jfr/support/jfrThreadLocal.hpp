@@ -49,6 +49,8 @@ class JfrThreadLocal {
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
+  jlong _sampled_cpu_time;
+  int64_t _native_unsampled_bytes;
   unsigned int _stack_trace_hash;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
@@ -191,6 +193,26 @@ class JfrThreadLocal {
     _cpu_time = cpu_time;
   }
 
+  // Thread CPU time seen by the thread sampler the last time it considered
+  // this thread for an execution sample.
+  jlong get_sampled_cpu_time() const {
+    return _sampled_cpu_time;
+  }
+
+  void set_sampled_cpu_time(jlong cpu_time) {
+    _sampled_cpu_time = cpu_time;
+  }
+
+  // Native memory allocated by the thread since its last
+  // NativeMemoryAllocationSample event.
+  int64_t native_unsampled_bytes() const {
+    return _native_unsampled_bytes;
+  }
+
+  void set_native_unsampled_bytes(int64_t bytes) {
+    _native_unsampled_bytes = bytes;
+  }
+
   jlong get_wallclock_time() const {
     return _wallclock_time;
   }
@@ -1759,6 +1759,9 @@ JVMCI::CodeInstallResult JVMCIRuntime::register_method(JVMCIEnv* JVMCIENV,
       } else {
         nm->set_has_unsafe_access(has_unsafe_access);
         nm->set_has_wide_vectors(has_wide_vector);
+        // JVMCI compilers do not report scoped accesses, so assume the
+        // installed code may perform one.
+        nm->set_has_scoped_access(true);
 
         // Record successful registration.
         // (Put nm into the task handle *before* publishing to the Java heap.)
@@ -41,28 +41,53 @@ class AsyncLogWriter::AsyncLogLocker : public StackObj {
   }
 };
 
-void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
-  if (_buffer.size() >= _buffer_max_size) {
+AsyncLogWriter::Buffer::Buffer(size_t capacity)
+  : _buf(NEW_C_HEAP_ARRAY(char, capacity, mtLogging)), _capacity(capacity), _pos(0) {
+  assert(capacity >= Message::calc_size(0), "capacity must be able to hold a flush token");
+}
+
+AsyncLogWriter::Buffer::~Buffer() {
+  FREE_C_HEAP_ARRAY(char, _buf);
+}
+
+bool AsyncLogWriter::Buffer::push_back(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  const size_t len = strlen(msg);
+  const size_t sz = Message::calc_size(len);
+  // Always leave headroom for the flush token, so that pushing a token cannot fail.
+  const size_t headroom = (output != nullptr) ? Message::calc_size(0) : 0;
+
+  if (_pos + sz > _capacity - headroom) {
+    return false;
+  }
+
+  new (_buf + _pos) Message(output, decorations, msg, len);
+  _pos += sz;
+  return true;
+}
+
+void AsyncLogWriter::Buffer::push_flush_token() {
+  using none = LogTagSetMapping<LogTag::__NO_TAG>;
+  LogDecorations d(LogLevel::Off, none::tagset(), LogDecorators::None);
+  bool result = push_back(nullptr, d, "");
+  assert(result, "failed to enqueue the flush token");
+}
+
+void AsyncLogWriter::enqueue_locked(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  if (!_buffer->push_back(output, decorations, msg)) {
     bool p_created;
-    uint32_t* counter = _stats.put_if_absent(msg.output(), 0, &p_created);
+    uint32_t* counter = _stats.put_if_absent(output, 0, &p_created);
     *counter = *counter + 1;
     // drop the enqueueing message.
-    os::free(msg.message());
     return;
   }
 
-  _buffer.push_back(msg);
   _data_available = true;
   _lock.notify();
 }
 
 void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
-  AsyncLogMessage m(&output, decorations, os::strdup(msg));
-
-  { // critical area
-    AsyncLogLocker locker;
-    enqueue_locked(m);
-  }
+  AsyncLogLocker locker;
+  enqueue_locked(&output, decorations, msg);
 }
 
 // LogMessageBuffer consists of a multiple-part/multiple-line messsage.
@@ -71,8 +96,7 @@ void AsyncLogWriter::enqueue(LogFileOutput& output, LogMessageBuffer::Iterator m
   AsyncLogLocker locker;
 
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
-    AsyncLogMessage m(&output, msg_iterator.decorations(), os::strdup(msg_iterator.message()));
-    enqueue_locked(m);
+    enqueue_locked(&output, msg_iterator.decorations(), msg_iterator.message());
   }
 }
 
@@ -80,73 +104,69 @@ AsyncLogWriter::AsyncLogWriter()
   : _flush_sem(0), _lock(), _data_available(false),
     _initialized(false),
     _stats() {
+  size_t size = AsyncLogBufferSize / 2;
+  _buffer = new Buffer(size);
+  _buffer_staging = new Buffer(size);
+
   if (os::create_thread(this, os::asynclog_thread)) {
     _initialized = true;
+    log_info(logging)("AsyncLogBuffer estimated memory use: " SIZE_FORMAT " bytes", size * 2);
   } else {
+    // Logging stays synchronous, the buffers are never used.
+    delete _buffer;
+    delete _buffer_staging;
+    _buffer = nullptr;
+    _buffer_staging = nullptr;
     log_warning(logging, thread)("AsyncLogging failed to create thread. Falling back to synchronous logging.");
   }
-
-  log_info(logging)("The maximum entries of AsyncLogBuffer: " SIZE_FORMAT ", estimated memory use: " SIZE_FORMAT " bytes",
-                    _buffer_max_size, AsyncLogBufferSize);
 }
 
-class AsyncLogMapIterator {
-  AsyncLogBuffer& _logs;
+// Moves the dropped message counters into a snapshot and resets them.
+class AsyncLogMapSnapshot {
+  AsyncLogMap& _snapshot;
 
  public:
-  AsyncLogMapIterator(AsyncLogBuffer& logs) :_logs(logs) {}
+  AsyncLogMapSnapshot(AsyncLogMap& snapshot) : _snapshot(snapshot) {}
   bool do_entry(LogFileOutput* output, uint32_t& counter) {
-    using none = LogTagSetMapping<LogTag::__NO_TAG>;
-
     if (counter > 0) {
-      LogDecorations decorations(LogLevel::Warning, none::tagset(), LogDecorators::All);
-      stringStream ss;
-      ss.print(UINT32_FORMAT_W(6) " messages dropped due to async logging", counter);
-      AsyncLogMessage msg(output, decorations, ss.as_string(true /*c_heap*/));
-      _logs.push_back(msg);
+      bool created = _snapshot.put(output, counter);
+      assert(created, "sanity check");
       counter = 0;
     }
-
     return true;
   }
 };
 
-void AsyncLogWriter::write() {
-  // Use kind of copy-and-swap idiom here.
-  // Empty 'logs' swaps the content with _buffer.
-  // Along with logs destruction, all processed messages are deleted.
-  //
-  // The operation 'pop_all()' is done in O(1). All I/O jobs are then performed without
-  // lock protection. This guarantees I/O jobs don't block logsites.
-  AsyncLogBuffer logs;
-
-  { // critical region
-    AsyncLogLocker locker;
-
-    _buffer.pop_all(&logs);
-    // append meta-messages of dropped counters
-    AsyncLogMapIterator dropped_counters_iter(logs);
-    _stats.iterate(&dropped_counters_iter);
-    _data_available = false;
+class AsyncLogMapIterator {
+ public:
+  bool do_entry(LogFileOutput* output, uint32_t& counter) {
+    using none = LogTagSetMapping<LogTag::__NO_TAG>;
+    LogDecorations decorations(LogLevel::Warning, none::tagset(), LogDecorators::All);
+    stringStream ss;
+    ss.print(UINT32_FORMAT_W(6) " messages dropped due to async logging", counter);
+    output->write_blocking(decorations, ss.base());
+    return true;
   }
+};
 
-  LinkedListIterator<AsyncLogMessage> it(logs.head());
-
+void AsyncLogWriter::write(AsyncLogMap& dropped) {
   int req = 0;
-  while (!it.is_empty()) {
-    AsyncLogMessage* e = it.next();
-    char* msg = e->message();
-
-    if (msg != nullptr) {
-      e->output()->write_blocking(e->decorations(), msg);
-      os::free(msg);
-    } else if (e->output() == nullptr) {
+  Buffer::Iterator it = _buffer_staging->iterator();
+  while (it.has_next()) {
+    const Message* e = it.next();
+
+    if (!e->is_token()) {
+      e->output()->write_blocking(e->decorations(), e->message());
+    } else {
       // This is a flush token. Record that we found it and then
       // signal the flushing thread after the loop.
       req++;
     }
   }
 
+  AsyncLogMapIterator dropped_counters_iter;
+  dropped.iterate(&dropped_counters_iter);
+
   if (req > 0) {
     assert(req == 1, "AsyncLogWriter::flush() is NOT MT-safe!");
     _flush_sem.signal(req);
@@ -155,15 +175,26 @@ void AsyncLogWriter::write() {
 
 void AsyncLogWriter::run() {
   while (true) {
+    AsyncLogMap dropped;
     {
       AsyncLogLocker locker;
 
       while (!_data_available) {
         _lock.wait(0/* no timeout */);
       }
+
+      // Only swap the buffers and take the dropped counters under the lock.
+      // All I/O jobs are then performed without lock protection. This
+      // guarantees I/O jobs don't block logsites.
+      _buffer_staging->reset();
+      swap(_buffer, _buffer_staging);
+
+      AsyncLogMapSnapshot snapshot(dropped);
+      _stats.iterate(&snapshot);
+      _data_available = false;
     }
 
-    write();
+    write(dropped);
   }
 }
 
@@ -199,13 +230,10 @@ AsyncLogWriter* AsyncLogWriter::instance() {
 void AsyncLogWriter::flush() {
   if (_instance != nullptr) {
     {
-      using none = LogTagSetMapping<LogTag::__NO_TAG>;
       AsyncLogLocker locker;
-      LogDecorations d(LogLevel::Off, none::tagset(), LogDecorators::None);
-      AsyncLogMessage token(nullptr, d, nullptr);
 
-      // Push directly in-case we are at logical max capacity, as this must not get dropped.
-      _instance->_buffer.push_back(token);
+      // The token always fits, as the buffer keeps room for it.
+      _instance->_buffer->push_flush_token();
       _instance->_data_available = true;
       _instance->_lock.notify();
     }
@@ -29,85 +29,9 @@
 #include "logging/logMessageBuffer.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/nonJavaThread.hpp"
+#include "utilities/align.hpp"
 #include "utilities/resourceHash.hpp"
-#include "utilities/linkedlist.hpp"
 
-template <typename E, MEMFLAGS F>
-class LinkedListDeque : private LinkedListImpl<E, ResourceObj::C_HEAP, F> {
- private:
-  LinkedListNode<E>* _tail;
-  size_t _size;
-
- public:
-  LinkedListDeque() : _tail(NULL), _size(0) {}
-  void push_back(const E& e) {
-    if (!_tail) {
-      _tail = this->add(e);
-    } else {
-      _tail = this->insert_after(e, _tail);
-    }
-
-    ++_size;
-  }
-
-  // pop all elements to logs.
-  void pop_all(LinkedList<E>* logs) {
-    logs->move(static_cast<LinkedList<E>* >(this));
-    _tail = NULL;
-    _size = 0;
-  }
-
-  void pop_all(LinkedListDeque<E, F>* logs) {
-    logs->_size = _size;
-    logs->_tail = _tail;
-    pop_all(static_cast<LinkedList<E>* >(logs));
-  }
-
-  void pop_front() {
-    LinkedListNode<E>* h = this->unlink_head();
-    if (h == _tail) {
-      _tail = NULL;
-    }
-
-    if (h != NULL) {
-      --_size;
-      this->delete_node(h);
-    }
-  }
-
-  size_t size() const { return _size; }
-
-  const E* front() const {
-    return this->_head == NULL ? NULL : this->_head->peek();
-  }
-
-  const E* back() const {
-    return _tail == NULL ? NULL : _tail->peek();
-  }
-
-  LinkedListNode<E>* head() const {
-    return this->_head;
-  }
-};
-
-class AsyncLogMessage {
-  LogFileOutput* _output;
-  const LogDecorations _decorations;
-  char* _message;
-
-public:
-  AsyncLogMessage(LogFileOutput* output, const LogDecorations& decorations, char* msg)
-    : _output(output), _decorations(decorations), _message(msg) {}
-
-  // placeholder for LinkedListImpl.
-  bool equals(const AsyncLogMessage& o) const { return false; }
-
-  LogFileOutput* output() const { return _output; }
-  const LogDecorations& decorations() const { return _decorations; }
-  char* message() const { return _message; }
-};
-
-typedef LinkedListDeque<AsyncLogMessage, mtLogging> AsyncLogBuffer;
 typedef ResourceHashtable<LogFileOutput*,
                           uint32_t,
                           17, /*table_size*/
@@ -119,6 +43,10 @@ typedef ResourceHashtable<LogFileOutput*,
 //
 // Summary:
 // Async Logging is working on the basis of singleton AsyncLogWriter, which manages an intermediate buffer and a flushing thread.
+// The buffer is a pair of preallocated byte buffers of AsyncLogBufferSize / 2 bytes each. Logsites copy the output, the
+// decorations and the message text inline into the current buffer; the flushing thread swaps the buffers and writes out the
+// other one. Enqueueing never allocates memory, and the lock is only held for the copy. Messages that don't fit are dropped
+// and accounted for per output.
 //
 // Interface:
 //
@@ -136,8 +64,85 @@ typedef ResourceHashtable<LogFileOutput*,
 // change the logging configuration via jcmd, LogConfiguration::configure_output() calls flush() under the protection of the
 // ConfigurationLock. In addition flush() is called during JVM termination, via LogConfiguration::finalize.
 class AsyncLogWriter : public NonJavaThread {
+  friend class AsyncLogTest_logBuffer_vm_Test;
   class AsyncLogLocker;
 
+  // Message is the envelope of a log line and its associated data. Its size is variable because the
+  // zero-terminated message text is stored right behind it. It is only valid when created by placement
+  // new within a Buffer.
+  //
+  // Example layout:
+  // ---------------------------------------------
+  // |_output|_decorations|"a log line",   |pad| <- Message aligned
+  // |_output|_decorations|"yet another",  |pad|
+  // ...
+  // |NULL   |_decorations|"",             |pad| <- flush token
+  // |<- _pos
+  // ---------------------------------------------
+  class Message {
+    NONCOPYABLE(Message);
+    ~Message() = delete;
+
+    LogFileOutput* const _output;
+    const LogDecorations _decorations;
+
+   public:
+    Message(LogFileOutput* output, const LogDecorations& decorations, const char* msg, size_t len)
+      : _output(output), _decorations(decorations) {
+      memcpy(reinterpret_cast<char*>(this + 1), msg, len + 1);
+    }
+
+    // Size of a Message object with a message text of message_len characters plus the trailing zero.
+    static constexpr size_t calc_size(size_t message_len) {
+      return align_up(sizeof(Message) + message_len + 1, alignof(Message));
+    }
+
+    size_t size() const {
+      return calc_size(strlen(message()));
+    }
+
+    bool is_token() const { return _output == nullptr; }
+    LogFileOutput* output() const { return _output; }
+    const LogDecorations& decorations() const { return _decorations; }
+    const char* message() const { return reinterpret_cast<const char*>(this + 1); }
+  };
+
+  class Buffer : public CHeapObj<mtLogging> {
+    char* const _buf;
+    const size_t _capacity;
+    size_t _pos;
+
+   public:
+    Buffer(size_t capacity);
+    ~Buffer();
+
+    // Appends a message. Returns false if there is no room for it.
+    // Room for one flush token is always kept in reserve.
+    bool push_back(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+    void push_flush_token();
+
+    void reset() { _pos = 0; }
+
+    class Iterator {
+      const Buffer& _buf;
+      size_t _curr;
+
+     public:
+      Iterator(const Buffer& buffer) : _buf(buffer), _curr(0) {}
+
+      bool has_next() const { return _curr < _buf._pos; }
+
+      const Message* next() {
+        assert(has_next(), "sanity check");
+        const Message* msg = reinterpret_cast<const Message*>(_buf._buf + _curr);
+        _curr = MIN2(_curr + msg->size(), _buf._pos);
+        return msg;
+      }
+    };
+
+    Iterator iterator() const { return Iterator(*this); }
+  };
+
   static AsyncLogWriter* _instance;
   Semaphore _flush_sem;
   // Can't use a Monitor here as we need a low-level API that can be used without Thread::current().
@@ -145,15 +150,14 @@ class AsyncLogWriter : public NonJavaThread {
   bool _data_available;
   volatile bool _initialized;
   AsyncLogMap _stats; // statistics for dropped messages
-  AsyncLogBuffer _buffer;
 
-  // The memory use of each AsyncLogMessage (payload) consists of itself and a variable-length c-str message.
-  // A regular logging message is smaller than vwrite_buffer_size, which is defined in logtagset.cpp
-  const size_t _buffer_max_size = {AsyncLogBufferSize / (sizeof(AsyncLogMessage) + vwrite_buffer_size)};
+  // Ping-pong buffers. Logsites append to _buffer, the AsyncLog Thread writes out _buffer_staging.
+  Buffer* _buffer;
+  Buffer* _buffer_staging;
 
   AsyncLogWriter();
-  void enqueue_locked(const AsyncLogMessage& msg);
-  void write();
+  void enqueue_locked(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+  void write(AsyncLogMap& dropped);
   void run() override;
   void pre_run() override {
     NonJavaThread::pre_run();
@@ -90,15 +90,47 @@ const char* LogDecorations::decoration(LogDecorators::Decorator decorator, char*
   return buf;
 }
 
+// Converting to broken-down local or UTC time is comparatively expensive, and
+// consecutive log lines from a thread are usually stamped within the same
+// second. Cache the last formatted timestamp per thread and only patch in the
+// milliseconds while the second is unchanged.
+static THREAD_LOCAL jlong _cached_time_seconds[2] = { -1, -1 };
+static THREAD_LOCAL char  _cached_time[2][os::iso8601_timestamp_size];
+
+const char* LogDecorations::iso8601_time(jlong millis, char* buf, size_t buflen, bool utc) {
+  // Output is of the form "YYYY-MM-DDThh:mm:ss.mmm+zzzz"
+  const size_t millis_offset = 20;
+  if (buflen < os::iso8601_timestamp_size) {
+    // Like os::iso8601_time.
+    return NULL;
+  }
+  const int index = utc ? 1 : 0;
+  const jlong seconds = millis / MILLIUNITS;
+  if (millis >= 0 && _cached_time_seconds[index] == seconds) {
+    const int millis_after_second = (int)(millis % MILLIUNITS);
+    memcpy(buf, _cached_time[index], os::iso8601_timestamp_size);
+    buf[millis_offset]     = '0' + (millis_after_second / 100);
+    buf[millis_offset + 1] = '0' + (millis_after_second / 10) % 10;
+    buf[millis_offset + 2] = '0' + (millis_after_second % 10);
+    return buf;
+  }
+  char* result = os::iso8601_time(millis, buf, buflen, utc);
+  if (result != NULL && millis >= 0 && result[millis_offset - 1] == '.') {
+    memcpy(_cached_time[index], result, os::iso8601_timestamp_size);
+    _cached_time_seconds[index] = seconds;
+  }
+  return result;
+}
+
 void LogDecorations::print_time_decoration(outputStream* st) const {
   char buf[os::iso8601_timestamp_size];
-  char* result = os::iso8601_time(_millis, buf, sizeof(buf), false);
+  const char* result = iso8601_time(_millis, buf, sizeof(buf), false);
   st->print_raw(result ? result : "");
 }
 
 void LogDecorations::print_utctime_decoration(outputStream* st) const {
   char buf[os::iso8601_timestamp_size];
-  char* result = os::iso8601_time(_millis, buf, sizeof(buf), true);
+  const char* result = iso8601_time(_millis, buf, sizeof(buf), true);
   st->print_raw(result ? result : "");
 }
 
@@ -67,6 +67,10 @@ class LogDecorations {
   void print_decoration(LogDecorators::Decorator decorator, outputStream* st) const;
   const char* decoration(LogDecorators::Decorator decorator, char* buf, size_t buflen) const;
 
+  // Same as os::iso8601_time, but reuses the last timestamp formatted by the
+  // current thread while the second is unchanged. Public for testing.
+  static const char* iso8601_time(jlong millis, char* buf, size_t buflen, bool utc);
+
 };
 
 #endif // SHARE_LOGGING_LOGDECORATIONS_HPP
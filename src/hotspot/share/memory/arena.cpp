@@ -23,6 +23,8 @@
  */
 
 #include "precompiled.hpp"
+#include "compiler/compilationMemoryStatistic.hpp"
+#include "compiler/compiler_globals.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -115,6 +117,24 @@ class ChunkPool {
     }
   }
 
+  // Return a chain of chunks, linked through next(), to their pools or to
+  // the C-heap while taking ThreadCritical only once for the whole chain.
+  static void free_chain(Chunk* chain) {
+    ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
+    while (chain != NULL) {
+      Chunk* next = chain->next();
+      ChunkPool* pool = get_pool_for_size(chain->length());
+      if (pool != NULL) {
+        chain->set_next(pool->_first);
+        pool->_first = chain;
+        pool->_num_chunks++;
+      } else {
+        os::free(chain);
+      }
+      chain = next;
+    }
+  }
+
   // Given a (inner payload) size, return the pool responsible for it, or NULL if the size is non-standard
   static ChunkPool* get_pool_for_size(size_t size) {
     for (int i = 0; i < _num_pools; i++) {
@@ -179,7 +199,7 @@ void* Chunk::operator new (size_t sizeofChunk, AllocFailType alloc_failmode, siz
   }
   // Either the pool was empty, or this is a non-standard length. Allocate a new Chunk from C-heap.
   size_t bytes = ARENA_ALIGN(sizeofChunk) + length;
-  void* p = os::malloc(bytes, mtChunk, CALLER_PC);
+  void* p = os::malloc(bytes, mtChunk, MALLOC_CALLER_PC);
   if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
     vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
   }
@@ -205,14 +225,15 @@ Chunk::Chunk(size_t length) : _len(length) {
 }
 
 void Chunk::chop() {
-  Chunk *k = this;
-  while( k ) {
-    Chunk *tmp = k->next();
-    // clear out this chunk (to detect allocation bugs)
-    if (ZapResourceArea) memset(k->bottom(), badResourceValue, k->length());
-    delete k;                   // Free chunk (was malloc'd)
-    k = tmp;
+  if (ZapResourceArea) {
+    for (Chunk* k = this; k != NULL; k = k->next()) {
+      // clear out this chunk (to detect allocation bugs)
+      memset(k->bottom(), badResourceValue, k->length());
+    }
   }
+  // Large arenas, e.g. of compiler threads, can hold many chunks, so give
+  // them all back in one go rather than taking ThreadCritical per chunk.
+  ChunkPool::free_chain(this);
 }
 
 void Chunk::next_chop() {
@@ -316,6 +337,9 @@ void Arena::set_size_in_bytes(size_t size) {
     ssize_t delta = size - size_in_bytes();
     _size_in_bytes = size;
     MemTracker::record_arena_size_change(delta, _flags);
+    if (CompilerMemoryStatistics) {
+      CompilationMemoryStatistic::on_arena_change(delta);
+    }
   }
 }
 
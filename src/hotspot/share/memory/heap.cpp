@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "logging/log.hpp"
 #include "memory/heap.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/os.hpp"
@@ -51,6 +52,7 @@ CodeHeap::CodeHeap(const char* name, const int code_blob_type)
   _adapter_count                = 0;
   _full_count                   = 0;
   _fragmentation_count          = 0;
+  _collapse_start               = NULL;
 }
 
 // Dummy initialization of template array.
@@ -258,6 +260,13 @@ bool CodeHeap::expand_by(size_t size) {
     char* base = _memory.low() + _memory.committed_size();
     if (!_memory.expand_by(dm)) return false;
     on_code_mapping(base, dm);
+    if (CodeCacheCollapseLargePages && UseTransparentHugePages &&
+        os::large_page_size() > (size_t)os::vm_page_size()) {
+      // Include the large page that base is in; it may only now be fully committed.
+      // The collapse itself is done by collapse_large_pages() without CodeCache_lock.
+      char* start = MAX2(align_down(base, os::large_page_size()), _memory.low());
+      _collapse_start = (_collapse_start == NULL) ? start : MIN2(_collapse_start, start);
+    }
     size_t i = _number_of_committed_segments;
     _number_of_committed_segments = size_to_segments(_memory.committed_size());
     assert(_number_of_reserved_segments == size_to_segments(_memory.reserved_size()), "number of reserved segments should not change");
@@ -274,6 +283,21 @@ bool CodeHeap::expand_by(size_t size) {
   return true;
 }
 
+void CodeHeap::collapse_large_pages() {
+  char* start;
+  char* end;
+  {
+    MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    start = _collapse_start;
+    end = _memory.high();
+    _collapse_start = NULL;
+  }
+  if (start != NULL && !os::collapse_large_pages(start, end - start)) {
+    log_debug(codecache)("Could not collapse " PTR_FORMAT "-" PTR_FORMAT " of %s into large pages",
+                         p2i(start), p2i(end), _name);
+  }
+}
+
 
 void* CodeHeap::allocate(size_t instance_size) {
   size_t number_of_segments = size_to_segments(instance_size + header_size());
@@ -562,6 +586,15 @@ size_t CodeHeap::heap_unallocated_capacity() const {
   return segments_to_size(_number_of_reserved_segments - _next_segment);
 }
 
+// Compared with unallocated_capacity(), this shows how fragmented the heap is.
+size_t CodeHeap::largest_free_block() const {
+  size_t largest = _number_of_reserved_segments - _next_segment;
+  for (FreeBlock* b = _freelist; b != NULL; b = b->link()) {
+    largest = MAX2(largest, b->length());
+  }
+  return segments_to_size(largest);
+}
+
 // Free list management
 
 FreeBlock* CodeHeap::following_block(FreeBlock *b) {
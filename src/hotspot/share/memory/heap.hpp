@@ -104,6 +104,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   int          _adapter_count;                   // Number of adapters
   int          _full_count;                      // Number of times the code heap was full
   int          _fragmentation_count;             // #FreeBlock joins without fully initializing segment map elements.
+  char*        _collapse_start;                  // Start of committed memory not yet collapsed into large pages, or NULL
 
   enum { free_sentinel = 0xFF };
   static const int fragmentation_limit = 10000;  // defragment after that many potential fragmentations.
@@ -150,6 +151,8 @@ class CodeHeap : public CHeapObj<mtCode> {
   // Heap extents
   bool  reserve(ReservedSpace rs, size_t committed_size, size_t segment_size);
   bool  expand_by(size_t size);                  // expands committed memory by size
+  bool  collapse_pending() const                 { return _collapse_start != NULL; }
+  void  collapse_large_pages();                  // collapses memory committed by expand_by; takes CodeCache_lock
 
   // Memory allocation
   void* allocate (size_t size); // Allocate 'size' bytes in the code cache or return NULL
@@ -202,6 +205,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t allocated_capacity() const;
   size_t max_allocated_capacity() const          { return _max_allocated_capacity; }
   size_t unallocated_capacity() const            { return max_capacity() - allocated_capacity(); }
+  size_t largest_free_block() const;             // largest single allocation that can currently succeed
 
   // Returns true if the CodeHeap contains CodeBlobs of the given type
   bool accepts(int code_blob_type) const         { return (_code_blob_type == CodeBlobType::All) ||
@@ -33,6 +33,7 @@
 #include "code/codeCache.hpp"
 #include "code/debugInfoRec.hpp"
 #include "compiler/compilationPolicy.hpp"
+#include "compiler/compilerOracle.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/bytecodeStream.hpp"
 #include "interpreter/bytecodeTracer.hpp"
@@ -1179,6 +1180,12 @@ void Method::unlink_method() {
   }
   NOT_PRODUCT(set_compiled_invocation_count(0);)
 
+  // Remember methods that were hot in the dumping run before the profile
+  // is dropped, so they can be compiled early when the archive is used.
+  if (highest_comp_level() == CompLevel_full_optimization) {
+    set_hot_at_dump(true);
+  }
+
   set_method_data(NULL);
   clear_method_counters();
 }
@@ -1210,6 +1217,8 @@ void Method::link_method(const methodHandle& h_method, TRAPS) {
       !native_bind_event_is_interesting);
   }
 
+  h_method->set_compile_ahead(CompilerOracle::should_compile_ahead(h_method));
+
   // Setup compiler entrypoint.  This is made eagerly, so we do not need
   // special handling of vtables.  An alternative is to make adapters more
   // lazily by calling make_adapter() from from_compiled_entry() for the
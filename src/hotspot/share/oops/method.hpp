@@ -90,7 +90,9 @@ class Method : public Metadata {
     _has_injected_profile  = 1 << 4,
     _intrinsic_candidate   = 1 << 5,
     _reserved_stack_access = 1 << 6,
-    _scoped                = 1 << 7
+    _scoped                = 1 << 7,
+    _hot_at_dump           = 1 << 8,
+    _compile_ahead         = 1 << 9
   };
   mutable u2 _flags;
 
@@ -844,6 +846,26 @@ public:
     _flags = x ? (_flags | _scoped) : (_flags & ~_scoped);
   }
 
+  // True if this archived method reached the highest tier in the run that
+  // dumped the CDS archive. Used by CompilationPolicy to compile it early.
+  bool is_hot_at_dump() const {
+    return (_flags & _hot_at_dump) != 0;
+  }
+
+  void set_hot_at_dump(bool x) {
+    _flags = x ? (_flags | _hot_at_dump) : (_flags & ~_hot_at_dump);
+  }
+
+  // True if this method matches a "compileahead" CompileCommand. Cached when
+  // the method is linked, so that call resolution does not query the oracle.
+  bool is_compile_ahead() const {
+    return (_flags & _compile_ahead) != 0;
+  }
+
+  void set_compile_ahead(bool x) {
+    _flags = x ? (_flags | _compile_ahead) : (_flags & ~_compile_ahead);
+  }
+
   bool intrinsic_candidate() {
     return (_flags & _intrinsic_candidate) != 0;
   }
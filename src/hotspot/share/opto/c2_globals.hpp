@@ -425,6 +425,11 @@
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
                                                                             \
+  product(uintx, RegisterAllocationTimeLimit, 0, EXPERIMENTAL,              \
+          "If nonzero, give up a C2 compilation whose register allocation " \
+          "is still splitting live ranges after this many milliseconds, "   \
+          "so that the method is compiled by C1 only (0 is no limit)")      \
+                                                                            \
   product(bool, UseJumpTables, true,                                        \
           "Use JumpTables instead of a binary search tree for switches")    \
                                                                             \
@@ -455,7 +460,7 @@
   product(bool, PrintPreciseRTMLockingStatistics, false, DIAGNOSTIC,        \
           "Print per-lock-site statistics of rtm locking in JVM")           \
                                                                             \
-  notproduct(bool, PrintEliminateLocks, false,                              \
+  product(bool, PrintEliminateLocks, false, DIAGNOSTIC,                     \
           "Print out when locks are eliminated")                            \
                                                                             \
   product(bool, EliminateAutoBox, true,                                     \
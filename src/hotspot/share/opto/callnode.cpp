@@ -2166,27 +2166,29 @@ Node *LockNode::Ideal(PhaseGVN *phase, bool can_reshape) {
         // add ourselves to the list of locks to be eliminated.
         lock_ops.append(this);
 
-  #ifndef PRODUCT
         if (PrintEliminateLocks) {
           int locks = 0;
           int unlocks = 0;
+  #ifndef PRODUCT
           if (Verbose) {
             tty->print_cr("=== Locks coarsening ===");
           }
+  #endif
           for (int i = 0; i < lock_ops.length(); i++) {
             AbstractLockNode* lock = lock_ops.at(i);
             if (lock->Opcode() == Op_Lock)
               locks++;
             else
               unlocks++;
+  #ifndef PRODUCT
             if (Verbose) {
               tty->print(" %d: ", i);
               lock->dump();
             }
+  #endif
           }
           tty->print_cr("=== Coarsened %d unlocks and %d locks", unlocks, locks);
         }
-  #endif
 
         // for each of the identified locks, mark them
         // as eliminatable
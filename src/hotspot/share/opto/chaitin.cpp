@@ -41,6 +41,7 @@
 #include "opto/movenode.hpp"
 #include "opto/opcodes.hpp"
 #include "opto/rootnode.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 
 #ifndef PRODUCT
@@ -346,6 +347,7 @@ void PhaseChaitin::Register_Allocate() {
   _trip_cnt = 0;
   _alternate = 0;
   _matcher._allocation_started = true;
+  jlong start_time_ns = (RegisterAllocationTimeLimit > 0) ? os::javaTimeNanos() : 0;
 
   ResourceArea split_arena(mtCompiler);     // Arena for Split local resources
   ResourceArea live_arena(mtCompiler);      // Arena for liveness & IFG info
@@ -526,6 +528,14 @@ void PhaseChaitin::Register_Allocate() {
         return;
       }
     }
+    // Every trip rebuilds liveness and the IFG, which is where huge methods
+    // spend their compile time. Past the limit the method is better off
+    // with the linear scan allocator of C1.
+    if (RegisterAllocationTimeLimit > 0 &&
+        os::javaTimeNanos() - start_time_ns > (jlong)millis_to_nanos(RegisterAllocationTimeLimit)) {
+      C->record_method_not_compilable("register allocation time limit exceeded");
+      return;
+    }
 
     if (!_lrg_map.max_lrg_id()) {
       return;
@@ -2089,11 +2089,9 @@ bool PhaseMacroExpand::eliminate_locking_node(AbstractLockNode *alock) {
 
   alock->log_lock_optimization(C, "eliminate_lock");
 
-#ifndef PRODUCT
   if (PrintEliminateLocks) {
     tty->print_cr("++++ Eliminated: %d %s '%s'", alock->_idx, (alock->is_Lock() ? "Lock" : "Unlock"), alock->kind_as_string());
   }
-#endif
 
   Node* mem  = alock->in(TypeFunc::Memory);
   Node* ctrl = alock->in(TypeFunc::Control);
@@ -2478,7 +2478,8 @@ void Node_List::dump_simple() const {
 //------------------------------remove-----------------------------------------
 void Unique_Node_List::remove(Node* n) {
   if (_in_worklist.test(n->_idx)) {
-    for (uint i = 0; i < size(); i++) {
+    // Search from the end: nodes removed by IGVN were usually pushed recently.
+    for (uint i = size(); i-- > 0; ) {
       if (_nodes[i] == n) {
         map(i, Node_List::pop());
         _in_worklist.remove(n->_idx);
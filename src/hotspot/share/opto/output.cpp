@@ -3407,6 +3407,7 @@ void PhaseOutput::install_code(ciMethod*         target,
                                      compiler,
                                      has_unsafe_access,
                                      SharedRuntime::is_wide_vector(C->max_vector_size()),
+                                     C->has_scoped_access(),
                                      C->rtm_state(),
                                      C->native_invokers());
 
@@ -3812,6 +3812,8 @@ bool SWPointer::invariant(Node* n) const {
 // Match: k*iv + offset
 // where: k is a constant that maybe zero, and
 //        offset is (k2 [+/- invariant]) where k2 maybe zero and invariant is optional
+// The sum may also be computed in long arithmetic, as in the int inner loop
+// of a transformed long counted loop: (outer_phi + ConvI2L(iv)) << shift.
 bool SWPointer::scaled_iv_plus_offset(Node* n) {
   NOT_PRODUCT(Tracer::Depth ddd;)
   NOT_PRODUCT(_tracer.scaled_iv_plus_offset_1(n);)
@@ -3827,7 +3829,7 @@ bool SWPointer::scaled_iv_plus_offset(Node* n) {
   }
 
   int opc = n->Opcode();
-  if (opc == Op_AddI) {
+  if (opc == Op_AddI || opc == Op_AddL) {
     if (offset_plus_k(n->in(2)) && scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_4(n);)
       return true;
@@ -3836,7 +3838,7 @@ bool SWPointer::scaled_iv_plus_offset(Node* n) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_5(n);)
       return true;
     }
-  } else if (opc == Op_SubI) {
+  } else if (opc == Op_SubI || opc == Op_SubL) {
     if (offset_plus_k(n->in(2), true) && scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_6(n);)
       return true;
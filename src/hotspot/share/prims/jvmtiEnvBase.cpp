@@ -1191,9 +1191,15 @@ MultipleStackTracesCollector::fill_frames(jthread jt, JavaThread *thr, oop threa
   infop->state = state;
 
   if (thr != NULL && (state & JVMTI_THREAD_STATE_ALIVE) != 0) {
-    infop->frame_buffer = NEW_RESOURCE_ARRAY(jvmtiFrameInfo, max_frame_count());
+    // Walk into a scratch buffer shared by all threads and keep only the
+    // frames actually found, most stacks are much shorter than max_frame_count.
+    if (_frame_buffer == NULL) {
+      _frame_buffer = NEW_RESOURCE_ARRAY(jvmtiFrameInfo, max_frame_count());
+    }
     env()->get_stack_trace(thr, 0, max_frame_count(),
-                           infop->frame_buffer, &(infop->frame_count));
+                           _frame_buffer, &(infop->frame_count));
+    infop->frame_buffer = NEW_RESOURCE_ARRAY(jvmtiFrameInfo, infop->frame_count);
+    memcpy(infop->frame_buffer, _frame_buffer, infop->frame_count * sizeof(jvmtiFrameInfo));
   } else {
     infop->frame_buffer = NULL;
     infop->frame_count = 0;
@@ -487,6 +487,7 @@ private:
   jvmtiError _result;
   int _frame_count_total;
   struct StackInfoNode *_head;
+  jvmtiFrameInfo *_frame_buffer;      // scratch buffer of max_frame_count frames
 
   JvmtiEnvBase *env()                 { return (JvmtiEnvBase *)_env; }
   jint max_frame_count()              { return _max_frame_count; }
@@ -500,7 +501,8 @@ public:
       _stack_info(NULL),
       _result(JVMTI_ERROR_NONE),
       _frame_count_total(0),
-      _head(NULL) {
+      _head(NULL),
+      _frame_buffer(NULL) {
   }
   void set_result(jvmtiError result)  { _result = result; }
   void fill_frames(jthread jt, JavaThread *thr, oop thread_oop);
@@ -29,6 +29,7 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -49,6 +50,7 @@
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "prims/jvmtiTagMapTable.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -68,6 +70,7 @@
 #include "utilities/macros.hpp"
 
 bool JvmtiTagMap::_has_object_free_events = false;
+volatile bool JvmtiTagMap::_gc_notification_pending = false;
 
 // create a JvmtiTagMap
 JvmtiTagMap::JvmtiTagMap(JvmtiEnv* env) :
@@ -148,8 +151,17 @@ void JvmtiTagMap::check_hashmap(bool post_events) {
   }
   if (_needs_rehashing) {
     log_info(jvmti, table)("TagMap table needs rehashing");
-    hashmap()->rehash();
+    // Without ObjectFree events the dead entries need no posting, so drop
+    // the ones already cleared while walking the table anyway.
+    bool remove_dead = _needs_cleaning && !env()->is_enabled(JVMTI_EVENT_OBJECT_FREE);
+    hashmap()->rehash(remove_dead);
     _needs_rehashing = false;
+    // Cleaning is done unless a GC may still clear more entries before its
+    // gc_notification. A new GC can only request cleaning at a safepoint,
+    // which cannot start while the lock is held outside of one.
+    if (remove_dead && !Atomic::load(&_gc_notification_pending)) {
+      _needs_cleaning = false;
+    }
   }
 }
 
@@ -1362,6 +1374,22 @@ class RestoreMarksClosure : public ObjectClosure {
   }
 };
 
+// Restores the mark bits of all objects using the GC's safepoint workers
+class ParRestoreMarksTask : public WorkerTask {
+ private:
+  ParallelObjectIterator* _poi;
+
+ public:
+  ParRestoreMarksTask(ParallelObjectIterator* poi) :
+    WorkerTask("Restore JVMTI Object Marks"),
+    _poi(poi) { }
+
+  void work(uint worker_id) {
+    RestoreMarksClosure blk;
+    _poi->object_iterate(&blk, worker_id);
+  }
+};
+
 // ObjectMarker provides the mark and visited functions
 class ObjectMarker : AllStatic {
  private:
@@ -1370,6 +1398,8 @@ class ObjectMarker : AllStatic {
   static GrowableArray<markWord>* _saved_mark_stack;
   static bool _needs_reset;                  // do we need to reset mark bits?
 
+  static void restore_marks();              // reset mark bits of all objects
+
  public:
   static void init();                       // initialize
   static void done();                       // clean-up
@@ -1398,13 +1428,29 @@ void ObjectMarker::init() {
   _saved_oop_stack = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<oop>(4000, mtServiceability);
 }
 
+// Iterate over all objects and restore the mark bits to their initial
+// value. This is a full walk of the heap, so use the GC's safepoint
+// workers if the GC supports parallel object iteration.
+void ObjectMarker::restore_marks() {
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != NULL) {
+    WithActiveWorkers with_active_workers(workers, workers->max_workers());
+    ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(workers->active_workers());
+    if (poi != NULL) {
+      ParRestoreMarksTask task(poi);
+      workers->run_task(&task);
+      delete poi;
+      return;
+    }
+  }
+  RestoreMarksClosure blk;
+  Universe::heap()->object_iterate(&blk);
+}
+
 // Object marking is done so restore object headers
 void ObjectMarker::done() {
-  // iterate over all objects and restore the mark bits to
-  // their initial value
-  RestoreMarksClosure blk;
   if (needs_reset()) {
-    Universe::heap()->object_iterate(&blk);
+    restore_marks();
   } else {
     // We don't need to reset mark bits on this call, but reset the
     // flag to the default for the next call.
@@ -3032,6 +3078,7 @@ void JvmtiTagMap::set_needs_cleaning() {
   // Can't assert !notified_needs_cleaning; a partial GC might be upgraded
   // to a full GC and do this twice without intervening gc_notification.
   DEBUG_ONLY(notified_needs_cleaning = true;)
+  Atomic::store(&_gc_notification_pending, true);
 
   JvmtiEnvIterator it;
   for (JvmtiEnv* env = it.first(); env != NULL; env = it.next(env)) {
@@ -3045,6 +3092,7 @@ void JvmtiTagMap::set_needs_cleaning() {
 void JvmtiTagMap::gc_notification(size_t num_dead_entries) {
   assert(notified_needs_cleaning, "missing GC notification");
   DEBUG_ONLY(notified_needs_cleaning = false;)
+  Atomic::store(&_gc_notification_pending, false);
 
   // Notify ServiceThread if there's work to do.
   {
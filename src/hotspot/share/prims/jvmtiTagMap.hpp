@@ -44,6 +44,9 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   bool                  _needs_cleaning;
 
   static bool           _has_object_free_events;
+  // Set between set_needs_cleaning and gc_notification, while a GC may still
+  // be clearing tag map entries concurrently.
+  static volatile bool  _gc_notification_pending;
 
   // create a tag map
   JvmtiTagMap(JvmtiEnv* env);
@@ -221,12 +221,14 @@ void JvmtiTagMapTable::remove_dead_entries(JvmtiEnv* env, bool post_object_free)
                           oops_counted, oops_removed, post_object_free ? "free object posted" : "no posting");
 }
 
-// Rehash oops in the table
-void JvmtiTagMapTable::rehash() {
+// Rehash oops in the table. If remove_dead is set, entries for dead oops
+// that need no ObjectFree posting are removed in the same pass.
+void JvmtiTagMapTable::rehash(bool remove_dead) {
   ResourceMark rm;
   GrowableArray<JvmtiTagMapEntry*> moved_entries;
 
   int oops_counted = 0;
+  int oops_removed = 0;
   for (int i = 0; i < table_size(); ++i) {
     JvmtiTagMapEntry** p = bucket_addr(i);
     JvmtiTagMapEntry* entry = bucket(i);
@@ -245,6 +247,11 @@ void JvmtiTagMapTable::rehash() {
         } else {
           p = entry->next_addr();
         }
+      } else if (remove_dead) {
+        oops_removed++;
+        log_trace(jvmti, table)("JvmtiTagMap entry removed for index %d", i);
+        *p = entry->next();
+        free_entry(entry);
       } else {
         // Skip removed oops. They may still have to be posted.
         p = entry->next_addr();
@@ -262,6 +269,6 @@ void JvmtiTagMapTable::rehash() {
     Hashtable<WeakHandle, mtServiceability>::add_entry(index, moved_entry);
   }
 
-  log_info(jvmti, table) ("JvmtiTagMap entries counted %d rehashed %d",
-                          oops_counted, rehash_len);
+  log_info(jvmti, table) ("JvmtiTagMap entries counted %d rehashed %d removed %d",
+                          oops_counted, rehash_len, oops_removed);
 }
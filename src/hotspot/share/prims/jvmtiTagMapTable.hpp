@@ -89,7 +89,7 @@ public:
 
   // Cleanup cleared entries and post
   void remove_dead_entries(JvmtiEnv* env, bool post_object_free);
-  void rehash();
+  void rehash(bool remove_dead);
   void clear();
 };
 
@@ -26,6 +26,7 @@
 #include "jni.h"
 #include "jvm.h"
 #include "classfile/vmSymbols.hpp"
+#include "code/compiledMethod.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
@@ -68,6 +69,14 @@ public:
   }
 };
 
+// Returns true if the compiled method is, or has inlined, a method that
+// accesses scoped memory. The compilers record this when they parse a
+// @Scoped method, so it also covers accesses whose liveness checks C2 has
+// moved out of the scoped method's own scope, e.g. hoisted out of a loop.
+static bool may_access_scoped_memory(CompiledMethod* cm) {
+  return cm->method()->is_scoped() || cm->has_scoped_access();
+}
+
 class CloseScopedMemoryClosure : public HandshakeClosure {
   jobject _deopt;
   jobject _exception;
@@ -107,8 +116,12 @@ public:
            //Found the deopt oop in a compiled method; deoptimize.
            Deoptimization::deoptimize(jt, last_frame);
       }
-      so... we unconditionally deoptimize, for now: */
-      Deoptimization::deoptimize(jt, last_frame);
+      so... we deoptimize whenever the frame may hold a scoped access.
+      Code that never touches scoped memory cannot be in the middle of an
+      access to the scope being closed, so it is left alone: */
+      if (may_access_scoped_memory(cm)) {
+        Deoptimization::deoptimize(jt, last_frame);
+      }
     }
 
     const int max_critical_stack_depth = 10;
@@ -59,6 +59,9 @@
 #include "utilities/copy.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/macros.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeMemoryAllocationSample.hpp"
+#endif
 
 /**
  * Implementation of the jdk.internal.misc.Unsafe class
@@ -339,6 +342,7 @@ UNSAFE_ENTRY(jlong, Unsafe_AllocateMemory0(JNIEnv *env, jobject unsafe, jlong si
   assert(is_aligned(sz, HeapWordSize), "sz not aligned");
 
   void* x = os::malloc(sz, mtOther);
+  JFR_ONLY(JfrNativeMemoryAllocationSample::send_event(x, sz);)
 
   return addr_to_java(x);
 } UNSAFE_END
@@ -350,6 +354,8 @@ UNSAFE_ENTRY(jlong, Unsafe_ReallocateMemory0(JNIEnv *env, jobject unsafe, jlong
   assert(is_aligned(sz, HeapWordSize), "sz not aligned");
 
   void* x = os::realloc(p, sz, mtOther);
+  // The old size is not known here, so the sample weight is the new size.
+  JFR_ONLY(JfrNativeMemoryAllocationSample::send_event(x, sz);)
 
   return addr_to_java(x);
 } UNSAFE_END
@@ -38,6 +38,7 @@
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/oopMapCache.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -899,13 +900,18 @@ void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   ResourceMark rm;
   DeoptimizationMarker dm;
 
+  jlong start = os::javaTimeNanos();
+
   // Make the dependent methods not entrant
+  int made_not_entrant = 0;
   if (nmethod_only != NULL) {
     nmethod_only->mark_for_deoptimization();
-    nmethod_only->make_not_entrant();
+    if (nmethod_only->make_not_entrant()) {
+      made_not_entrant = 1;
+    }
   } else {
     MutexLocker mu(SafepointSynchronize::is_at_safepoint() ? NULL : CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    CodeCache::make_marked_nmethods_not_entrant();
+    made_not_entrant = CodeCache::make_marked_nmethods_not_entrant();
   }
 
   DeoptimizeMarkedClosure deopt;
@@ -914,6 +920,18 @@ void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   } else {
     Handshake::execute(&deopt);
   }
+
+  // Mass invalidations (class redefinition, call site target changes,
+  // dependency violations) are followed by a wave of recompilations.
+  // Record their size so such storms can be correlated with the
+  // compile queue backlog.
+  if (made_not_entrant > 0) {
+    jlong elapsed_us = (os::javaTimeNanos() - start) / (NANOUNITS / MICROUNITS);
+    Events::log(Thread::current_or_null(), "Deoptimized %d nmethods in " JLONG_FORMAT " us",
+                made_not_entrant, elapsed_us);
+    log_info(deoptimization)("Made %d nmethods not entrant in " JLONG_FORMAT " us",
+                             made_not_entrant, elapsed_us);
+  }
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
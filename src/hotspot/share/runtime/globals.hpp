@@ -170,6 +170,12 @@ const intx ObjectAlignmentInBytes = 8;
   product(uint, HandshakeTimeout, 0, DIAGNOSTIC,                            \
           "If nonzero set a timeout in milliseconds for handshakes")        \
                                                                             \
+  product(uint, ParallelHandshakeThreshold, 0, EXPERIMENTAL,                \
+          "If nonzero, the VM thread uses worker threads to execute a "     \
+          "handshake with at least this many target threads for the "       \
+          "threads that are blocked or in native, if the handshake "        \
+          "closure is parallel safe")                                       \
+                                                                            \
   product(bool, AlwaysSafeConstructors, false, EXPERIMENTAL,                \
           "Force safe construction, as if all fields are final.")           \
                                                                             \
@@ -223,6 +229,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Maximum number of pages to include in the page scan procedure")  \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, UseNUMAPageScanning, false, EXPERIMENTAL,                   \
+          "After each GC, scan up to NUMAPageScanRate pages of the "        \
+          "NUMA-aware spaces and release pages placed on the wrong node "   \
+          "so they are faulted in again on the right one")                  \
+                                                                            \
   product(bool, UseAES, false,                                              \
           "Control whether AES instructions are used when available")       \
                                                                             \
@@ -414,6 +425,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Time out and warn or fail after SafepointTimeoutDelay "          \
           "milliseconds if failed to reach safepoint")                      \
                                                                             \
+  product(uint, SafepointArrivalThreshold, 0, DIAGNOSTIC,                   \
+          "If nonzero, report the code location of threads that reach a "   \
+          "safepoint poll in compiled code more than this many "            \
+          "milliseconds after the safepoint began")                         \
+                                                                            \
   product(bool, AbortVMOnSafepointTimeout, false, DIAGNOSTIC,               \
           "Abort upon failure to reach safepoint (see SafepointTimeout)")   \
                                                                             \
@@ -546,6 +562,12 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, "off",                               \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uint, NMTStackSamplingInterval, 1, DIAGNOSTIC,                    \
+          "In NMT detail mode, record the call stack of only every n-th "   \
+          "malloc of a thread. Mallocs without a stack are reported "       \
+          "under an empty call stack. Virtual memory is not sampled")       \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -705,6 +727,12 @@ const intx ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                      \
           range(1024, max_jint)                                             \
                                                                             \
+  product(intx, MonitorDeflationScanMax, 0, DIAGNOSTIC,                     \
+          "The maximum number of in-use monitors examined by one async "    \
+          "deflation cycle (0 is no limit). A cycle that reaches the "      \
+          "limit is continued where it stopped by the next cycle.")         \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, MonitorUsedDeflationThreshold, 90, DIAGNOSTIC,              \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on GuaranteedSafepointInterval "    \
@@ -792,6 +820,12 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, RestrictContended, true,                                    \
           "Restrict @Contended to trusted classes")                         \
                                                                             \
+  product(ccstrlist, HotFields, "", EXPERIMENTAL,                           \
+          "Instance fields to place at the start of their class' layout, "  \
+          "next to the object header. Comma or space separated list of "    \
+          "Class.field entries, with the class name in internal form, "     \
+          "e.g. java/lang/String.value")                                    \
+                                                                            \
   product(intx, DiagnoseSyncOnValueBasedClasses, 0, DIAGNOSTIC,             \
              "Detect and take action upon identifying synchronization on "  \
              "value based classes. Modes: "                                 \
@@ -945,6 +979,10 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(bool, PrintVMLockContentionAtExit, false, DIAGNOSTIC,             \
+             "Record how often and how long threads wait for the named "    \
+             "VM-internal locks, and print the statistics at exit")         \
+                                                                            \
   product(bool, UseNotificationThread, true,                                \
           "Use Notification Thread")                                        \
                                                                             \
@@ -1556,6 +1594,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, SegmentedCodeCache, false,                                  \
           "Use a segmented code cache")                                     \
                                                                             \
+  product(bool, CodeCacheCollapseLargePages, false, EXPERIMENTAL,           \
+          "Back newly committed code cache memory with transparent huge "   \
+          "pages soon after expansion instead of waiting for the OS to do " \
+          "it. Requires UseTransparentHugePages")                           \
+                                                                            \
   product_pd(uintx, ReservedCodeCacheSize,                                  \
           "Reserved code cache size (in bytes) - maximum code cache size")  \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
@@ -1947,6 +1990,15 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, SharedClassListFile, NULL,                                 \
           "Override the default CDS class list")                            \
                                                                             \
+  product(ccstr, PreloadClassListFile, NULL,                                \
+          "Load and link the classes in the specified class list on "       \
+          "background threads during startup")                              \
+                                                                            \
+  product(uint, PreloadClassThreads, 2,                                     \
+          "Number of threads used to preload the classes in "               \
+          "PreloadClassListFile")                                           \
+          range(1, 256)                                                     \
+                                                                            \
   product(ccstr, SharedArchiveFile, NULL,                                   \
           "Override the default location of the CDS archive file")          \
                                                                             \
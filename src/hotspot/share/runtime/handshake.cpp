@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "jvm_io.h"
+#include "gc/shared/workerPolicy.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -78,6 +80,7 @@ class HandshakeOperation : public CHeapObj<mtThread> {
   const char* name()               { return _handshake_cl->name(); }
   bool is_async()                  { return _handshake_cl->is_async(); }
   bool is_suspend()                { return _handshake_cl->is_suspend(); }
+  bool is_parallel_safe()          { return _handshake_cl->is_parallel_safe(); }
 };
 
 class AsyncHandshakeOperation : public HandshakeOperation {
@@ -228,6 +231,51 @@ static void log_handshake_info(jlong start_time_ns, const char* name, int target
   }
 }
 
+// Lets worker threads execute an all threads handshake on behalf of the VM
+// thread for the targets that are already safe, which otherwise are processed
+// one at a time by the VM thread. Only operations whose closure is parallel
+// safe are processed, other operations queued for a target are left for the
+// serial loop of the VM thread.
+class ParallelHandshakeTask : public WorkerTask {
+  HandshakeOperation* const _op;
+  ThreadsList* const _list;
+  volatile uint _claimed;
+  volatile int _executed;
+
+ public:
+  ParallelHandshakeTask(HandshakeOperation* op, ThreadsList* list) :
+    WorkerTask("Parallel Handshake"),
+    _op(op),
+    _list(list),
+    _claimed(0),
+    _executed(0) {}
+
+  void work(uint worker_id) {
+    for (uint i = Atomic::fetch_and_add(&_claimed, 1u);
+         i < _list->length();
+         i = Atomic::fetch_and_add(&_claimed, 1u)) {
+      HandshakeState::ProcessResult pr = _list->thread_at(i)->handshake_state()->try_process(_op, true /* match_op_only */);
+      if (pr == HandshakeState::_succeeded) {
+        Atomic::inc(&_executed);
+      }
+    }
+  }
+
+  int executed() const { return Atomic::load(&_executed); }
+};
+
+// The handshake operation is not run at a safepoint, so the safepoint workers
+// of the GC may be busy. Parallel handshakes use their own workers, created
+// during VM startup if ParallelHandshakeThreshold is set.
+static WorkerThreads* _handshake_workers = NULL;
+
+void Handshake::initialize() {
+  if (ParallelHandshakeThreshold > 0) {
+    _handshake_workers = new WorkerThreads("Handshake Worker", WorkerPolicy::parallel_worker_threads());
+    _handshake_workers->set_active_workers(_handshake_workers->max_workers());
+  }
+}
+
 class VM_HandshakeAllThreads: public VM_Operation {
   HandshakeOperation* const _op;
  public:
@@ -257,6 +305,20 @@ class VM_HandshakeAllThreads: public VM_Operation {
     // Keeps count on how many of own emitted handshakes
     // this thread execute.
     int emitted_handshakes_executed = 0;
+
+    if (ParallelHandshakeThreshold > 0 &&
+        (uint)number_of_threads_issued >= ParallelHandshakeThreshold &&
+        _op->is_parallel_safe()) {
+      WorkerThreads* workers = _handshake_workers;
+      if (workers->active_workers() > 1) {
+        // Do the first pass over the safe threads in parallel; the loop
+        // below picks up whatever is left.
+        ParallelHandshakeTask task(_op, jtiwh.list());
+        workers->run_task(&task);
+        emitted_handshakes_executed += task.executed();
+      }
+    }
+
     do {
       // Check if handshake operation has timed out
       check_handshake_timeout(start_time_ns, _op);
@@ -319,8 +381,8 @@ void HandshakeOperation::do_handshake(JavaThread* thread) {
 
   if (start_time_ns != 0) {
     jlong completion_time = os::javaTimeNanos() - start_time_ns;
-    log_debug(handshake, task)("Operation: %s for thread " PTR_FORMAT ", is_vm_thread: %s, completed in " JLONG_FORMAT " ns",
-                               name(), p2i(thread), BOOL_TO_STR(Thread::current()->is_VM_thread()), completion_time);
+    log_debug(handshake, task)("Operation: %s for thread " PTR_FORMAT ", executed by %s, completed in " JLONG_FORMAT " ns",
+                               name(), p2i(thread), Thread::current()->type_name(), completion_time);
   }
 
   // Inform VMThread/Handshaker that we have completed the operation.
@@ -571,7 +633,7 @@ bool HandshakeState::claim_handshake() {
   return false;
 }
 
-HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* match_op) {
+HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* match_op, bool match_op_only) {
   if (!has_operation()) {
     // JT has already cleared its handshake
     return HandshakeState::_no_operation;
@@ -603,9 +665,14 @@ HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* ma
   assert(SafepointMechanism::local_poll_armed(_handshakee), "Must be");
   assert(op->_target == NULL || _handshakee == op->_target, "Wrong thread");
 
+  if (match_op_only && op != match_op) {
+    _lock.unlock();
+    return HandshakeState::_claim_failed;
+  }
+
   log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
                        op == match_op ? "handshaker" : "cooperative",
-                       current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+                       current_thread->type_name());
 
   op->prepare(_handshakee, current_thread);
 
@@ -617,7 +684,7 @@ HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* ma
   _lock.unlock();
 
   log_trace(handshake)("%s(" INTPTR_FORMAT ") executed an op for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
-                       current_thread->is_VM_thread() ? "VM Thread" : "JavaThread",
+                       current_thread->type_name(),
                        p2i(current_thread), p2i(_handshakee),
                        op == match_op ? "including" : "excluding", p2i(match_op));
 
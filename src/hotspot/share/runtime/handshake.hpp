@@ -51,6 +51,10 @@ class HandshakeClosure : public ThreadClosure, public CHeapObj<mtThread> {
   const char* name() const                         { return _name; }
   virtual bool is_async()                          { return false; }
   virtual bool is_suspend()                        { return false; }
+  // Closures that may be executed for different targets at the same time,
+  // and by worker threads, opt in to the parallel processing of all threads
+  // handshakes (see ParallelHandshakeThreshold).
+  virtual bool is_parallel_safe()                  { return false; }
   virtual void do_thread(Thread* thread) = 0;
 };
 
@@ -63,6 +67,8 @@ class AsyncHandshakeClosure : public HandshakeClosure {
 
 class Handshake : public AllStatic {
  public:
+  // Creates the worker threads for parallel handshakes, if enabled.
+  static void initialize();
   // Execution of handshake operation
   static void execute(HandshakeClosure*       hs_cl);
   // This version of execute() relies on a ThreadListHandle somewhere in
@@ -144,7 +150,9 @@ class HandshakeState {
     _succeeded,
     _number_states
   };
-  ProcessResult try_process(HandshakeOperation* match_op);
+  // With match_op_only, operations other than match_op are left for the
+  // handshakee or the VMThread/Handshaker.
+  ProcessResult try_process(HandshakeOperation* match_op, bool match_op_only = false);
 
   Thread* active_handshaker() const { return Atomic::load(&_active_handshaker); }
 
@@ -336,6 +336,10 @@ void print_statistics() {
     MetaspaceUtils::print_basic_report(tty, 0);
   }
 
+  if (PrintVMLockContentionAtExit) {
+    print_lock_contention(tty);
+  }
+
   ThreadsSMRSupport::log_statistics();
 }
 
@@ -387,6 +391,10 @@ void print_statistics() {
     MetaspaceUtils::print_basic_report(tty, 0);
   }
 
+  if (PrintVMLockContentionAtExit) {
+    print_lock_contention(tty);
+  }
+
   if (LogTouchedMethods && PrintTouchedMethodsAtExit) {
     Method::print_touched_methods(tty);
   }
@@ -35,6 +35,7 @@
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -81,6 +82,74 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+oop* JNIHandleCache::allocate(OopStorage* storage) {
+  if (_released) {
+    return storage->allocate();
+  }
+  if (_count == 0) {
+    _count = storage->allocate(_entries, _capacity);
+    if (_count == 0) {
+      return NULL;
+    }
+  }
+  return _entries[--_count];
+}
+
+void JNIHandleCache::release(OopStorage* storage, oop* ptr) {
+  if (_released) {
+    storage->release(ptr);
+    return;
+  }
+  if (_count == _capacity) {
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+  _entries[_count++] = ptr;
+}
+
+void JNIHandleCache::release_all(OopStorage* storage) {
+  if (_count > 0) {
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+  _released = true;
+}
+
+// The current thread's global or weak global handle cache, or NULL if it
+// should not be used. The cache is only changed by a thread in the VM, so
+// it is stable at safepoints. Checked JNI wants to detect the use of
+// destroyed handles, so destroyed entries are not kept for it.
+static JNIHandleCache* current_handle_cache(bool weak) {
+  Thread* thread = Thread::current_or_null();
+  if (thread == NULL || !thread->is_Java_thread() || CheckJNICalls) {
+    return NULL;
+  }
+  JavaThread* jt = JavaThread::cast(thread);
+  if (jt->thread_state() != _thread_in_vm) {
+    return NULL;
+  }
+  return weak ? jt->weak_global_handle_cache() : jt->global_handle_cache();
+}
+
+static oop* allocate_global_entry(OopStorage* storage, bool weak) {
+  JNIHandleCache* cache = current_handle_cache(weak);
+  return cache != NULL ? cache->allocate(storage) : storage->allocate();
+}
+
+static void release_global_entry(OopStorage* storage, bool weak, oop* ptr) {
+  JNIHandleCache* cache = current_handle_cache(weak);
+  if (cache != NULL) {
+    cache->release(storage, ptr);
+  } else {
+    storage->release(ptr);
+  }
+}
+
+void JNIHandles::release_handle_caches(JavaThread* thread) {
+  thread->global_handle_cache()->release_all(global_handles());
+  thread->weak_global_handle_cache()->release_all(weak_global_handles());
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -88,7 +157,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_global_entry(global_handles(), false /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -109,7 +178,7 @@ jobject JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_global_entry(weak_global_handles(), true /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -148,7 +217,7 @@ void JNIHandles::destroy_global(jobject handle) {
     assert(!is_jweak(handle), "wrong method for detroying jweak");
     oop* oop_ptr = jobject_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)NULL);
-    global_handles()->release(oop_ptr);
+    release_global_entry(global_handles(), false /* weak */, oop_ptr);
   }
 }
 
@@ -158,7 +227,7 @@ void JNIHandles::destroy_weak_global(jobject handle) {
     assert(is_jweak(handle), "JNI handle not jweak");
     oop* oop_ptr = jweak_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)NULL);
-    weak_global_handles()->release(oop_ptr);
+    release_global_entry(weak_global_handles(), true /* weak */, oop_ptr);
   }
 }
 
@@ -266,13 +335,31 @@ size_t JNIHandles::weak_global_handle_memory_usage() {
 }
 
 
+static size_t cached_handle_count(bool weak) {
+  size_t count = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    count += weak ? jt->weak_global_handle_cache()->count() : jt->global_handle_cache()->count();
+  }
+  return count;
+}
+
+// The caches only change in the VM, so the counts are exact at a safepoint.
+size_t JNIHandles::global_handle_count() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  return global_handles()->allocation_count() - cached_handle_count(false /* weak */);
+}
+
+size_t JNIHandles::weak_global_handle_count() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  return weak_global_handles()->allocation_count() - cached_handle_count(true /* weak */);
+}
+
 // We assume this is called at a safepoint: no lock is needed.
 void JNIHandles::print_on(outputStream* st) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
 
   st->print_cr("JNI global refs: " SIZE_FORMAT ", weak refs: " SIZE_FORMAT,
-               global_handles()->allocation_count(),
-               weak_global_handles()->allocation_count());
+               global_handle_count(), weak_global_handle_count());
   st->cr();
   st->flush();
 }
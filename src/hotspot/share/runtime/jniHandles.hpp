@@ -32,6 +32,32 @@ class JavaThread;
 class OopStorage;
 class Thread;
 
+// A small per-thread cache of entries of a JNI global or weak global handle
+// OopStorage. Entries are allocated in bulk, so making handles only takes the
+// storage's allocation lock once per batch. Entries of destroyed handles are
+// kept for reuse, and released to the storage in batches when the cache is
+// full. Cached entries are null, but allocated as far as the storage is
+// concerned. Once release_all() has been called the cache is bypassed.
+class JNIHandleCache {
+  static const size_t _capacity = 16;
+  oop* _entries[_capacity];
+  size_t _count;
+  bool _released;
+
+ public:
+  JNIHandleCache() : _count(0), _released(false) {}
+
+  // Number of entries currently held by the cache.
+  size_t count() const { return _count; }
+
+  // Returns NULL if the storage is out of memory.
+  oop* allocate(OopStorage* storage);
+  // Takes the null entry of a destroyed handle.
+  void release(OopStorage* storage, oop* ptr);
+  // Release all cached entries back to storage, and stop caching.
+  void release_all(OopStorage* storage);
+};
+
 // Interface for creating and resolving local/global JNI handles
 
 class JNIHandles : AllStatic {
@@ -99,6 +125,14 @@ class JNIHandles : AllStatic {
   static void destroy_weak_global(jobject handle);
   static bool is_global_weak_cleared(jweak handle); // Test jweak without resolution
 
+  // Release the global handle entries cached by an exiting thread
+  static void release_handle_caches(JavaThread* thread);
+
+  // Number of global and weak global handles in use, not counting the
+  // entries cached by threads. Must be called at a safepoint.
+  static size_t global_handle_count();
+  static size_t weak_global_handle_count();
+
   // Debugging
   static void print_on(outputStream* st);
   static void print();
@@ -112,6 +112,12 @@ void Mutex::lock_contended(Thread* self) {
   } while (!_lock.try_lock());
 }
 
+void Mutex::record_contention(jlong start_nanos) {
+  // Called with _lock held, so no atomics are needed.
+  _contended_count++;
+  _contended_nanos += os::javaTimeNanos() - start_nanos;
+}
+
 void Mutex::lock(Thread* self) {
   assert(owner() != self, "invariant");
 
@@ -120,7 +126,13 @@ void Mutex::lock(Thread* self) {
 
   if (!_lock.try_lock()) {
     // The lock is contended, use contended slow-path function to lock
-    lock_contended(self);
+    if (PrintVMLockContentionAtExit) {
+      jlong start = os::javaTimeNanos();
+      lock_contended(self);
+      record_contention(start);
+    } else {
+      lock_contended(self);
+    }
   }
 
   assert_owner(NULL);
@@ -143,7 +155,13 @@ void Mutex::lock_without_safepoint_check(Thread * self) {
   check_no_safepoint_state(self);
   check_rank(self);
 
-  _lock.lock();
+  if (!PrintVMLockContentionAtExit) {
+    _lock.lock();
+  } else if (!_lock.try_lock()) {
+    jlong start = os::javaTimeNanos();
+    _lock.lock();
+    record_contention(start);
+  }
   assert_owner(NULL);
   set_owner(self);
 }
@@ -272,7 +290,8 @@ Mutex::~Mutex() {
   os::free(const_cast<char*>(_name));
 }
 
-Mutex::Mutex(Rank rank, const char * name, bool allow_vm_block) : _owner(NULL) {
+Mutex::Mutex(Rank rank, const char * name, bool allow_vm_block) :
+  _owner(NULL), _contended_count(0), _contended_nanos(0) {
   assert(os::mutex_init_done(), "Too early!");
   assert(name != NULL, "Mutex requires a name");
   _name = os::strdup(name, mtInternal);
@@ -294,6 +313,11 @@ bool Mutex::owned_by_self() const {
   return owner() == Thread::current();
 }
 
+void Mutex::print_contention_on(outputStream* st) const {
+  st->print_cr("%-32s contended " UINT64_FORMAT_W(10) " times, waited %10.3f ms",
+               _name, _contended_count, (double)_contended_nanos / NANOSECS_PER_MILLISEC);
+}
+
 void Mutex::print_on_error(outputStream* st) const {
   st->print("[" PTR_FORMAT, p2i(this));
   st->print("] %s", _name);
@@ -92,6 +92,11 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   os::PlatformMonitor _lock;             // Native monitor implementation
   const char* _name;                     // Name of mutex/monitor
 
+  // Contention statistics, updated by the thread that just acquired the lock
+  // after having to wait for it. Only maintained with PrintVMLockContentionAtExit.
+  uint64_t _contended_count;
+  jlong    _contended_nanos;
+
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
   bool    _allow_vm_block;
@@ -169,6 +174,7 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   bool try_lock(); // Like lock(), but unblocking. It returns false instead
  private:
   void lock_contended(Thread *thread); // contended slow-path
+  void record_contention(jlong start_nanos);
   bool try_lock_inner(bool do_rank_checks);
  public:
 
@@ -190,6 +196,8 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   const char *name() const                  { return _name; }
 
   void print_on_error(outputStream* st) const;
+  uint64_t contended_count() const          { return _contended_count; }
+  void print_contention_on(outputStream* st) const;
   #ifndef PRODUCT
     void print_on(outputStream* st) const;
     void print() const                      { print_on(::tty); }
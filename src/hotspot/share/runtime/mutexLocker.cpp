@@ -129,6 +129,7 @@ Monitor* JfrThreadSampler_lock        = NULL;
 Mutex*   UnsafeJlong_lock             = NULL;
 #endif
 Mutex*   CodeHeapStateAnalytics_lock  = NULL;
+Mutex*   CompilationMemoryStatistic_lock = NULL;
 
 Mutex*   Metaspace_lock               = NULL;
 Mutex*   ClassLoaderDataGraph_lock    = NULL;
@@ -313,6 +314,7 @@ void mutex_init() {
 #endif
 
   def(CodeHeapStateAnalytics_lock  , PaddedMutex  , safepoint);
+  def(CompilationMemoryStatistic_lock, PaddedMutex , safepoint);
   def(NMethodSweeperStats_lock     , PaddedMutex  , nosafepoint);
   def(ThreadsSMRDelete_lock        , PaddedMonitor, nosafepoint-3); // Holds ConcurrentHashTableResize_lock
   def(ThreadIdTableCreate_lock     , PaddedMutex  , safepoint);
@@ -395,3 +397,12 @@ void print_owned_locks_on_error(outputStream* st) {
   }
   if (none) st->print_cr("None");
 }
+
+void print_lock_contention(outputStream* st) {
+  st->print_cr("VM Mutex/Monitor contention:");
+  for (int i = 0; i < _num_mutex; i++) {
+    if (_mutex_array[i]->contended_count() > 0) {
+      _mutex_array[i]->print_contention_on(st);
+    }
+  }
+}
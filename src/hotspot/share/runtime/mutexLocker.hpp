@@ -145,6 +145,7 @@ extern Mutex*   ClassLoaderDataGraph_lock;       // protects CLDG list, needed f
 
 extern Mutex*   CodeHeapStateAnalytics_lock;     // lock print functions against concurrent analyze functions.
                                                  // Only used locally in PrintCodeCacheLayout processing.
+extern Mutex*   CompilationMemoryStatistic_lock; // protects the table of the most expensive compilations
 
 #if INCLUDE_JVMCI
 extern Monitor* JVMCI_lock;                      // Monitor to control initialization of JVMCI
@@ -172,6 +173,10 @@ extern Mutex* tty_lock;                          // lock to synchronize output.
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
 
+// Print contention statistics for the named VM locks; requires
+// PrintVMLockContentionAtExit.
+void print_lock_contention(outputStream* st);
+
 char *lock_name(Mutex *mutex);
 
 // for debugging: check that we're already owning this lock (or are at a safepoint / handshake)
@@ -400,10 +400,9 @@ static void signal_thread_entry(JavaThread* thread, TRAPS) {
         // Any SIGBREAK operations added here should make sure to flush
         // the output stream (e.g. tty->flush()) after output.  See 4803766.
         // Each module also prints an extra carriage return after its output.
-        VM_PrintThreads op(tty, PrintConcurrentLocks, false /* no extended info */, true /* print JNI handle info */);
+        VM_PrintThreads op(tty, PrintConcurrentLocks, false /* no extended info */, true /* print JNI handle info */,
+                           true /* print deadlocks */);
         VMThread::execute(&op);
-        VM_FindDeadlocks op1(tty);
-        VMThread::execute(&op1);
         Universe::print_heap_at_SIGBREAK();
         if (PrintClassHistogram) {
           VM_GC_HeapInspection op1(tty, true /* force full GC before heap inspection */);
@@ -640,7 +639,7 @@ static bool has_reached_max_malloc_test_peak(size_t alloc_size) {
 }
 
 void* os::malloc(size_t size, MEMFLAGS flags) {
-  return os::malloc(size, flags, CALLER_PC);
+  return os::malloc(size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -710,7 +709,7 @@ void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS flags) {
-  return os::realloc(memblock, size, flags, CALLER_PC);
+  return os::realloc(memblock, size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -1718,6 +1717,15 @@ void os::initialize_initial_active_processor_count() {
   log_debug(os)("Initial active processor count set to %d" , _initial_active_processor_count);
 }
 
+uint os::scale_by_active_processors(uint count) {
+  const uint initial_cpus = (uint) initial_active_processor_count();
+  const uint current_cpus = (uint) active_processor_count();
+  if (current_cpus < initial_cpus) {
+    return (uint) (((julong) count * current_cpus + initial_cpus - 1) / initial_cpus);
+  }
+  return count;
+}
+
 void os::SuspendedThreadTask::run() {
   internal_do_task();
   _done = true;
@@ -1884,6 +1892,10 @@ void os::realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   pd_realign_memory(addr, bytes, alignment_hint);
 }
 
+bool os::collapse_large_pages(char* addr, size_t bytes) {
+  return pd_collapse_large_pages(addr, bytes);
+}
+
 char* os::reserve_memory_special(size_t size, size_t alignment, size_t page_size,
                                  char* addr, bool executable) {
 
@@ -158,6 +158,7 @@ class os: AllStatic {
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  static bool   pd_collapse_large_pages(char* addr, size_t bytes);
 
   static char*  pd_reserve_memory_special(size_t size, size_t alignment, size_t page_size,
 
@@ -276,6 +277,11 @@ class os: AllStatic {
     return _initial_active_processor_count;
   }
 
+  // Scales count down in proportion if fewer processors are active now than
+  // at startup, e.g. because the CPU quota of the container has been lowered.
+  // Rounds up, so the result is only 0 if count is.
+  static uint scale_by_active_processors(uint count);
+
   // Give a name to the current thread.
   static void set_native_thread_name(const char *name);
 
@@ -401,6 +407,9 @@ class os: AllStatic {
   static bool   unmap_memory(char *addr, size_t bytes);
   static void   free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Ask the OS to back the large page aligned part of a committed range
+  // with large pages now. Returns false if this is not supported.
+  static bool   collapse_large_pages(char* addr, size_t bytes);
 
   // NUMA-specific interface
   static bool   numa_has_static_binding();
@@ -418,7 +427,9 @@ class os: AllStatic {
     size_t size;
     int lgrp_id;
   };
-  static bool   get_page_info(char *start, page_info* info);
+  // Fills in info[0..count) for the count consecutive pages of page_size
+  // bytes starting at start. Returns false if page placement is unknown.
+  static bool   get_page_info(char *start, size_t page_size, size_t count, page_info* info);
   static char*  scan_pages(char *start, char* end, page_info* page_expected, page_info* page_found);
 
   static char*  non_memory_address_word();
@@ -859,6 +870,11 @@ class os: AllStatic {
   // System loadavg support.  Returns -1 if load average cannot be obtained.
   static int loadavg(double loadavg[], int nelem);
 
+  // Memory pressure support. Sets pressure to the recent share of time (in
+  // percent) some tasks were stalled waiting for memory. Returns -1 if memory
+  // pressure cannot be obtained.
+  static int memory_pressure(double* pressure);
+
   // Amount beyond the callee frame size that we bang the stack.
   static int extra_bang_size_in_bytes();
 
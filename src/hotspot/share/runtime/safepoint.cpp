@@ -41,6 +41,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -90,6 +91,65 @@ static void post_safepoint_cleanup_event(EventSafepointCleanup& event, uint64_t
   }
 }
 
+// Late arrivals at the current safepoint (see SafepointArrivalThreshold),
+// recorded by the arriving threads.
+struct LateSafepointArrival {
+  JavaThread*     _thread;
+  CompiledMethod* _nm;
+  address         _pc;
+  bool            _is_return_poll;
+  jlong           _delay_ns;
+};
+
+static const uint MaxLateSafepointArrivals = 16;
+static LateSafepointArrival _late_arrivals[MaxLateSafepointArrivals];
+static volatile uint _num_late_arrivals = 0;
+
+// Called by the VM thread once all threads are safe. The recording threads
+// are blocked, and their compiled methods cannot go away before the
+// safepoint operation runs, so decoding the scopes is safe here.
+static void report_late_safepoint_arrivals(uint64_t safepoint_id) {
+  assert(Thread::current()->is_VM_thread(), "must be VM thread");
+  uint num_arrivals = Atomic::load(&_num_late_arrivals);
+  if (num_arrivals == 0) {
+    return;
+  }
+
+  ResourceMark rm;
+  uint num_recorded = MIN2(num_arrivals, MaxLateSafepointArrivals);
+  for (uint i = 0; i < num_recorded; i++) {
+    LateSafepointArrival* arrival = &_late_arrivals[i];
+    CompiledMethod* nm = arrival->_nm;
+    Method* method = nm->method();
+    int bci = -1;
+    if (!arrival->_is_return_poll && nm->pc_desc_at(arrival->_pc) != NULL) {
+      ScopeDesc* sd = nm->scope_desc_at(arrival->_pc);
+      method = sd->method();
+      bci = sd->bci();
+    }
+
+    log_info(safepoint)("Thread " INTPTR_FORMAT " reached safepoint " UINT64_FORMAT
+                        " after " JLONG_FORMAT " ms at %s @ %d (pc " INTPTR_FORMAT ")",
+                        p2i(arrival->_thread), safepoint_id, (jlong)nanos_to_millis(arrival->_delay_ns),
+                        method->name_and_sig_as_C_string(), bci, p2i(arrival->_pc));
+
+    EventSafepointLateArrival event;
+    if (event.should_commit()) {
+      event.set_safepointId(safepoint_id);
+      event.set_thread(JFR_THREAD_ID(arrival->_thread));
+      event.set_method(method);
+      event.set_bci(bci);
+      event.set_delay(arrival->_delay_ns);
+      event.commit();
+    }
+  }
+  if (num_arrivals > num_recorded) {
+    log_info(safepoint)("%u more threads reached safepoint " UINT64_FORMAT " late",
+                        num_arrivals - num_recorded, safepoint_id);
+  }
+  Atomic::store(&_num_late_arrivals, 0u);
+}
+
 static void post_safepoint_synchronize_event(EventSafepointStateSynchronization& event,
                                              uint64_t safepoint_id,
                                              int initial_number_of_threads,
@@ -427,6 +487,8 @@ void SafepointSynchronize::begin() {
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
+  report_late_safepoint_arrivals(_safepoint_id);
+
   // We do the safepoint cleanup first since a GC related safepoint
   // needs cleanup to be completed before running the GC op.
   EventSafepointCleanup cleanup_event;
@@ -888,6 +950,32 @@ void ThreadSafepointState::print_on(outputStream *st) const {
 // ---------------------------------------------------------------------------------------------------------------------
 
 // Process pending operation.
+// Record threads that reach a poll long after the safepoint began. The
+// poll a late thread finally takes usually follows the loop or call that
+// kept it from reaching the safepoint. The arriving thread only records the
+// pc and the delay, the report is made by the VM thread once the safepoint
+// is reached.
+static void record_late_safepoint_arrival(JavaThread* thread, CompiledMethod* nm,
+                                          address pc, bool is_return_poll) {
+  if (SafepointArrivalThreshold == 0 || !SafepointSynchronize::is_synchronizing()) {
+    return;
+  }
+  jlong delay_ns = os::javaTimeNanos() - SafepointTracing::start_of_safepoint();
+  if (delay_ns < (jlong)millis_to_nanos(SafepointArrivalThreshold)) {
+    return;
+  }
+
+  uint idx = Atomic::fetch_and_add(&_num_late_arrivals, 1u);
+  if (idx < MaxLateSafepointArrivals) {
+    LateSafepointArrival* arrival = &_late_arrivals[idx];
+    arrival->_thread = thread;
+    arrival->_nm = nm;
+    arrival->_pc = pc;
+    arrival->_is_return_poll = is_return_poll;
+    arrival->_delay_ns = delay_ns;
+  }
+}
+
 void ThreadSafepointState::handle_polling_page_exception() {
   JavaThread* self = thread();
   assert(self == JavaThread::current(), "must be self");
@@ -909,6 +997,8 @@ void ThreadSafepointState::handle_polling_page_exception() {
   // Should only be poll_return or poll
   assert( nm->is_at_poll_or_poll_return(real_return_addr), "should not be at call" );
 
+  record_late_safepoint_arrival(self, nm, real_return_addr, nm->is_at_poll_return(real_return_addr));
+
   // This is a poll immediately before a return. The exception handling code
   // has already had the effect of causing the return to occur, so the execution
   // will continue immediately after the call. In addition, the oopmap at the
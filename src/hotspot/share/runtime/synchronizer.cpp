@@ -78,15 +78,18 @@ size_t MonitorList::max() const {
   return Atomic::load(&_max);
 }
 
-// Walk the in-use list and unlink (at most MonitorDeflationMax) deflated
-// ObjectMonitors. Returns the number of unlinked ObjectMonitors.
+// Walk the in-use list and unlink (at most max_count) deflated
+// ObjectMonitors. If start is not NULL, the walk begins after that live
+// ObjectMonitor instead of at the head of the list. Returns the number
+// of unlinked ObjectMonitors.
 size_t MonitorList::unlink_deflated(Thread* current, LogStream* ls,
                                     elapsedTimer* timer_p,
+                                    ObjectMonitor* start, size_t max_count,
                                     GrowableArray<ObjectMonitor*>* unlinked_list) {
   size_t unlinked_count = 0;
-  ObjectMonitor* prev = NULL;
+  ObjectMonitor* prev = start;
   ObjectMonitor* head = Atomic::load_acquire(&_head);
-  ObjectMonitor* m = head;
+  ObjectMonitor* m = (start == NULL) ? head : start->next_om();
   // The in-use list head can be NULL during the final audit.
   while (m != NULL) {
     if (m->is_being_async_deflated()) {
@@ -97,7 +100,7 @@ size_t MonitorList::unlink_deflated(Thread* current, LogStream* ls,
         unlinked_count++;
         unlinked_list->append(next);
         next = next_next;
-        if (unlinked_count >= (size_t)MonitorDeflationMax) {
+        if (unlinked_count >= max_count) {
           // Reached the max so bail out on the gathering loop.
           break;
         }
@@ -114,7 +117,7 @@ size_t MonitorList::unlink_deflated(Thread* current, LogStream* ls,
       } else {
         prev->set_next_om(next);
       }
-      if (unlinked_count >= (size_t)MonitorDeflationMax) {
+      if (unlinked_count >= max_count) {
         // Reached the max so bail out on the searching loop.
         break;
       }
@@ -240,6 +243,9 @@ bool volatile ObjectSynchronizer::_is_async_deflation_requested = false;
 bool volatile ObjectSynchronizer::_is_final_audit = false;
 jlong ObjectSynchronizer::_last_async_deflation_time_ns = 0;
 static uintx _no_progress_cnt = 0;
+// The last live ObjectMonitor examined by a partial deflation walk, or NULL
+// if the next walk starts at the head of the in-use list.
+static ObjectMonitor* _deflation_resume_point = NULL;
 
 // =====================> Quick functions
 
@@ -817,10 +823,15 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
       if (test == mark) {                  // if the hash was installed, return it
         return hash;
       }
-      // Failed to install the hash. It could be that another thread
-      // installed the hash just before our attempt or inflation has
-      // occurred or... so we fall thru to inflate the monitor for
-      // stability and then install the hash.
+      if (test.is_neutral()) {
+        // The header is still unlocked, so another thread raced us and
+        // installed its hash first. Retry to pick up that hash rather than
+        // inflating a monitor for an object nobody has locked.
+        continue;
+      }
+      // Failed to install the hash. It could be that the object was
+      // locked or inflation has occurred or... so we fall thru to inflate
+      // the monitor for stability and then install the hash.
     } else if (mark.has_monitor()) {
       monitor = mark.monitor();
       temp = monitor->header();
@@ -1317,19 +1328,35 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
 }
 
 // Walk the in-use list and deflate (at most MonitorDeflationMax) idle
-// ObjectMonitors. Returns the number of deflated ObjectMonitors.
+// ObjectMonitors. If start is not NULL, the walk begins after that live
+// ObjectMonitor. The MonitorDeflationThread examines at most
+// MonitorDeflationScanMax ObjectMonitors per call and records the last
+// live one it saw in _deflation_resume_point so that the next call can
+// continue from there. *reached_end is set if the walk got to the end of
+// the list. Returns the number of deflated ObjectMonitors.
 size_t ObjectSynchronizer::deflate_monitor_list(Thread* current, LogStream* ls,
-                                                elapsedTimer* timer_p) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
+                                                elapsedTimer* timer_p,
+                                                ObjectMonitor* start,
+                                                bool* reached_end) {
+  MonitorList::Iterator iter = (start == NULL) ? _in_use_list.iterator()
+                                               : MonitorList::Iterator(start->next_om());
+  size_t scan_max = (current->is_Java_thread() && MonitorDeflationScanMax > 0) ?
+                    (size_t)MonitorDeflationScanMax : SIZE_MAX;
   size_t deflated_count = 0;
+  size_t scanned_count = 0;
+  ObjectMonitor* last_live = start;
 
   while (iter.has_next()) {
-    if (deflated_count >= (size_t)MonitorDeflationMax) {
+    if (deflated_count >= (size_t)MonitorDeflationMax ||
+        scanned_count >= scan_max) {
       break;
     }
     ObjectMonitor* mid = iter.next();
+    scanned_count++;
     if (mid->deflate_monitor()) {
       deflated_count++;
+    } else {
+      last_live = mid;
     }
 
     if (current->is_Java_thread()) {
@@ -1339,6 +1366,10 @@ size_t ObjectSynchronizer::deflate_monitor_list(Thread* current, LogStream* ls,
     }
   }
 
+  *reached_end = !iter.has_next();
+  // Only the MonitorDeflationThread deflates and unlinks ObjectMonitors,
+  // so a live ObjectMonitor stays on the in-use list until the next call.
+  _deflation_resume_point = *reached_end ? NULL : last_live;
   return deflated_count;
 }
 
@@ -1346,6 +1377,8 @@ class HandshakeForDeflation : public HandshakeClosure {
  public:
   HandshakeForDeflation() : HandshakeClosure("HandshakeForDeflation") {}
 
+  bool is_parallel_safe() { return true; }
+
   void do_thread(Thread* thread) {
     log_trace(monitorinflation)("HandshakeForDeflation::do_thread: thread="
                                 INTPTR_FORMAT, p2i(thread));
@@ -1379,8 +1412,12 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
     timer.start();
   }
 
-  // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(current, ls, &timer);
+  // Deflate some idle ObjectMonitors. The MonitorDeflationThread continues
+  // a walk that was cut short by MonitorDeflationScanMax; the final audit
+  // always walks the whole list.
+  ObjectMonitor* start = current->is_Java_thread() ? _deflation_resume_point : NULL;
+  bool reached_end = false;
+  size_t deflated_count = deflate_monitor_list(current, ls, &timer, start, &reached_end);
   if (deflated_count > 0 || is_final_audit()) {
     // There are ObjectMonitors that have been deflated or this is the
     // final audit and all the remaining ObjectMonitors have been
@@ -1390,7 +1427,15 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
     // Unlink deflated ObjectMonitors from the in-use list.
     ResourceMark rm;
     GrowableArray<ObjectMonitor*> delete_list((int)deflated_count);
+    // All of this cycle's deflated ObjectMonitors follow start (or the
+    // head), so a bounded walk can stop unlinking once it has found all
+    // of them. The final audit may also find ObjectMonitors that the
+    // MonitorDeflationThread deflated but did not get to unlink.
+    bool bounded_walk = current->is_Java_thread() && MonitorDeflationScanMax > 0;
+    size_t unlink_max = (bounded_walk && !is_final_audit()) ?
+                        deflated_count : (size_t)MonitorDeflationMax;
     size_t unlinked_count = _in_use_list.unlink_deflated(current, ls, &timer,
+                                                         start, unlink_max,
                                                          &delete_list);
     if (current->is_Java_thread()) {
       if (ls != NULL) {
@@ -1447,7 +1492,9 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   if (deflated_count != 0) {
     _no_progress_cnt = 0;
-  } else {
+  } else if (reached_end) {
+    // A partial walk that found nothing idle says little about the rest
+    // of the list, so only count complete walks as no progress.
     _no_progress_cnt++;
   }
 
@@ -46,6 +46,7 @@ private:
 public:
   void add(ObjectMonitor* monitor);
   size_t unlink_deflated(Thread* current, LogStream* ls, elapsedTimer* timer_p,
+                         ObjectMonitor* start, size_t max_count,
                          GrowableArray<ObjectMonitor*>* unlinked_list);
   size_t count() const;
   size_t max() const;
@@ -147,7 +148,8 @@ class ObjectSynchronizer : AllStatic {
                                 const char* cnt_name, size_t cnt, LogStream* ls,
                                 elapsedTimer* timer_p);
   static size_t deflate_monitor_list(Thread* current, LogStream* ls,
-                                     elapsedTimer* timer_p);
+                                     elapsedTimer* timer_p, ObjectMonitor* start,
+                                     bool* reached_end);
   static size_t in_use_list_ceiling();
   static void dec_in_use_list_ceiling();
   static void inc_in_use_list_ceiling();
@@ -28,6 +28,7 @@
 #include "cds/dynamicArchive.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoader.hpp"
+#include "classfile/classPreloader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/javaThreadStatus.hpp"
 #include "classfile/systemDictionary.hpp"
@@ -1067,6 +1068,8 @@ JavaThread::JavaThread() :
   _jvmti_thread_state(nullptr),
   _interp_only_mode(0),
   _should_post_on_exceptions_flag(JNI_FALSE),
+  _counter_sample_countdown(0),
+  _counter_sample_seed(os::random() | 1), // xorshift state must not be zero
   _thread_stat(new ThreadStatistics()),
 
   _parker(),
@@ -1459,6 +1462,8 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_handle_caches(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1529,6 +1534,8 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_handle_caches(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -2882,6 +2889,8 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     }
   }
 
+  Handshake::initialize();
+
   assert(Universe::is_fully_initialized(), "not initialized");
   if (VerifyDuringStartup) {
     // Make sure we're starting with a clean slate.
@@ -3031,6 +3040,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // Notify JVMTI agents that VM initialization is complete - nop if no agents.
   JvmtiExport::post_vm_initialized();
 
+  // Start loading the classes of PreloadClassListFile in the background. This
+  // is done in the live phase so that JVMTI agents see the classes load.
+  ClassPreloader::initialize(CHECK_JNI_ERR);
+
   JFR_ONLY(Jfr::on_create_vm_3();)
 
 #if INCLUDE_MANAGEMENT
@@ -36,6 +36,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/javaFrameAnchor.hpp"
+#include "runtime/jniHandles.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/park.hpp"
@@ -741,6 +742,11 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Entries for new JNI global and weak global handles, and entries of
+  // destroyed ones kept for reuse
+  JNIHandleCache _global_handle_cache;
+  JNIHandleCache _weak_global_handle_cache;
+
  public:
   volatile intptr_t _Stalled;
 
@@ -772,6 +778,8 @@ class JavaThread: public Thread {
   JNIHandleBlock* active_handles() const         { return _active_handles; }
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
+  JNIHandleCache* global_handle_cache()          { return &_global_handle_cache; }
+  JNIHandleCache* weak_global_handle_cache()     { return &_weak_global_handle_cache; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
 
   void push_jni_handle_block();
@@ -1306,6 +1314,12 @@ class JavaThread: public Thread {
   static ByteSize should_post_on_exceptions_flag_offset() {
     return byte_offset_of(JavaThread, _should_post_on_exceptions_flag);
   }
+  static ByteSize counter_sample_countdown_offset() {
+    return byte_offset_of(JavaThread, _counter_sample_countdown);
+  }
+  static ByteSize counter_sample_seed_offset() {
+    return byte_offset_of(JavaThread, _counter_sample_seed);
+  }
   static ByteSize doing_unsafe_access_offset() { return byte_offset_of(JavaThread, _doing_unsafe_access); }
   NOT_PRODUCT(static ByteSize requires_cross_modify_fence_offset()  { return byte_offset_of(JavaThread, _requires_cross_modify_fence); })
 
@@ -1553,6 +1567,13 @@ class JavaThread: public Thread {
   int   should_post_on_exceptions_flag()  { return _should_post_on_exceptions_flag; }
   void  set_should_post_on_exceptions_flag(int val)  { _should_post_on_exceptions_flag = val; }
 
+ private:
+  // Countdown to the next update of the invocation and backedge counters
+  // by C1 profiled code, and the xorshift state the countdown is drawn from
+  // (see C1CounterSamplingLog)
+  int    _counter_sample_countdown;
+  int    _counter_sample_seed;
+
  private:
   ThreadStatistics *_thread_stat;
 
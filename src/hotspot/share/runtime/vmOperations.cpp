@@ -166,11 +166,37 @@ bool VM_PrintThreads::doit_prologue() {
   return true;
 }
 
+static void print_deadlocks(DeadlockCycle* deadlocks, ThreadsList* t_list, outputStream* out) {
+  int num_deadlocks = 0;
+  for (DeadlockCycle* cycle = deadlocks; cycle != NULL; cycle = cycle->next()) {
+    num_deadlocks++;
+    cycle->print_on_with(t_list, out);
+  }
+
+  if (num_deadlocks == 1) {
+    out->print_cr("\nFound 1 deadlock.\n");
+    out->flush();
+  } else if (num_deadlocks > 1) {
+    out->print_cr("\nFound %d deadlocks.\n", num_deadlocks);
+    out->flush();
+  }
+}
+
 void VM_PrintThreads::doit() {
   Threads::print_on(_out, true, false, _print_concurrent_locks, _print_extended_info);
   if (_print_jni_handle_info) {
     JNIHandles::print_on(_out);
   }
+  if (_print_deadlocks) {
+    ThreadsListHandle tlh;
+    DeadlockCycle* deadlocks = ThreadService::find_deadlocks_at_safepoint(tlh.list(), true /* concurrent_locks */);
+    print_deadlocks(deadlocks, tlh.list(), _out);
+    while (deadlocks != NULL) {
+      DeadlockCycle* d = deadlocks;
+      deadlocks = deadlocks->next();
+      delete d;
+    }
+  }
 }
 
 void VM_PrintThreads::doit_epilogue() {
@@ -205,19 +231,7 @@ void VM_FindDeadlocks::doit() {
 
   _deadlocks = ThreadService::find_deadlocks_at_safepoint(_setter.list(), _concurrent_locks);
   if (_out != NULL) {
-    int num_deadlocks = 0;
-    for (DeadlockCycle* cycle = _deadlocks; cycle != NULL; cycle = cycle->next()) {
-      num_deadlocks++;
-      cycle->print_on_with(_setter.list(), _out);
-    }
-
-    if (num_deadlocks == 1) {
-      _out->print_cr("\nFound 1 deadlock.\n");
-      _out->flush();
-    } else if (num_deadlocks > 1) {
-      _out->print_cr("\nFound %d deadlocks.\n", num_deadlocks);
-      _out->flush();
-    }
+    print_deadlocks(_deadlocks, _setter.list(), _out);
   }
 }
 
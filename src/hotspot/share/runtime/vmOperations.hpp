@@ -144,13 +144,18 @@ class VM_PrintThreads: public VM_Operation {
   bool _print_concurrent_locks;
   bool _print_extended_info;
   bool _print_jni_handle_info;
+  bool _print_deadlocks;
  public:
   VM_PrintThreads()
-    : _out(tty), _print_concurrent_locks(PrintConcurrentLocks), _print_extended_info(false), _print_jni_handle_info(false)
+    : _out(tty), _print_concurrent_locks(PrintConcurrentLocks), _print_extended_info(false), _print_jni_handle_info(false),
+      _print_deadlocks(false)
   {}
-  VM_PrintThreads(outputStream* out, bool print_concurrent_locks, bool print_extended_info, bool print_jni_handle_info)
+  // If print_deadlocks is set, deadlocks are detected and printed at the
+  // same safepoint, as a separate VM_FindDeadlocks would do.
+  VM_PrintThreads(outputStream* out, bool print_concurrent_locks, bool print_extended_info, bool print_jni_handle_info,
+                  bool print_deadlocks = false)
     : _out(out), _print_concurrent_locks(print_concurrent_locks), _print_extended_info(print_extended_info),
-      _print_jni_handle_info(print_jni_handle_info)
+      _print_jni_handle_info(print_jni_handle_info), _print_deadlocks(print_deadlocks)
   {}
   VMOp_Type type() const {
     return VMOp_PrintThreads;
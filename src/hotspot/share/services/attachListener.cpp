@@ -183,14 +183,11 @@ static jint thread_dump(AttachOperation* op, outputStream* out) {
     }
   }
 
-  // thread stacks and JNI global handles
-  VM_PrintThreads op1(out, print_concurrent_locks, print_extended_info, true /* print JNI handle info */);
+  // thread stacks, JNI global handles and deadlock detection
+  VM_PrintThreads op1(out, print_concurrent_locks, print_extended_info, true /* print JNI handle info */,
+                      true /* print deadlocks */);
   VMThread::execute(&op1);
 
-  // Deadlock detection
-  VM_FindDeadlocks op2(out);
-  VMThread::execute(&op2);
-
   return JNI_OK;
 }
 
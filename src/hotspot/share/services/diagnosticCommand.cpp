@@ -30,6 +30,7 @@
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationMemoryStatistic.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
 #include "gc/shared/gcVMOperations.hpp"
@@ -124,6 +125,7 @@ void DCmdRegistrant::register_dcmds(){
 #endif // LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TouchedMethodsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeHeapAnalyticsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilationMemoryStatisticDCmd>(full_export, true, false));
 
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesPrintDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesAddDCmd>(full_export, true, false));
@@ -540,13 +542,10 @@ ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
-  // thread stacks and JNI global handles
-  VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
-  VMThread::execute(&op1);
-
-  // Deadlock detection
-  VM_FindDeadlocks op2(output());
-  VMThread::execute(&op2);
+  // thread stacks, JNI global handles and deadlock detection
+  VM_PrintThreads op(output(), _locks.value(), _extended.value(), true /* print JNI handle info */,
+                     true /* print deadlocks */);
+  VMThread::execute(&op);
 }
 
 // Enhanced JMX Agent support
@@ -881,6 +880,16 @@ void EventLogDCmd::execute(DCmdSource source, TRAPS) {
   }
 }
 
+CompilationMemoryStatisticDCmd::CompilationMemoryStatisticDCmd(outputStream* output, bool heap) :
+                               DCmdWithParser(output, heap),
+  _minsize("minsize", "Minimum peak size of the compilations to print", "MEMORY SIZE", false, "0") {
+  _dcmdparser.add_dcmd_option(&_minsize);
+}
+
+void CompilationMemoryStatisticDCmd::execute(DCmdSource source, TRAPS) {
+  CompilationMemoryStatistic::print_all_by_size(output(), (size_t)_minsize.value()._size);
+}
+
 void CompilerDirectivesPrintDCmd::execute(DCmdSource source, TRAPS) {
   DirectivesStack::print(output());
 }
@@ -667,6 +667,29 @@ public:
 };
 //---<  END  >--- CodeHeap State Analytics.
 
+class CompilationMemoryStatisticDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<MemorySizeArgument> _minsize;
+public:
+  CompilationMemoryStatisticDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.memory";
+  }
+  static const char* description() {
+    return "Print the compilations with the largest peak arena memory "
+           "(requires -XX:+CompilerMemoryStatistics).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CompilerDirectivesPrintDCmd : public DCmd {
 public:
   CompilerDirectivesPrintDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
@@ -44,6 +44,7 @@
 #include "oops/typeArrayOop.inline.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
@@ -386,6 +387,7 @@ class AbstractDumpWriter : public StackObj {
   enum {
     io_buffer_max_size = 1*M,
     io_buffer_max_waste = 10*K,
+    io_buffers_queued_per_thread = 8,
     dump_segment_header_size = 9
   };
 
@@ -611,7 +613,7 @@ class DumpWriter : public AbstractDumpWriter {
 
  public:
   // Takes ownership of the writer and compressor.
-  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor);
+  DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor, uint num_dump_threads);
 
   // total number of bytes written to the disk
   julong bytes_written() const override { return (julong) _backend.get_written(); }
@@ -622,15 +624,20 @@ class DumpWriter : public AbstractDumpWriter {
   void writer_loop()                    { _backend.thread_loop(); }
   // Called when finish to release the threads.
   void deactivate() override            { flush(); _backend.deactivate(); }
+  // Called at the end of the safepoint to release the threads, leaving the
+  // queued data to be written by deactivate().
+  void release_threads()                { flush(); _backend.release_threads(); }
   // Get the backend pointer, used by parallel dump writer.
   CompressionBackend* backend_ptr()     { return &_backend; }
 
 };
 
 // Check for error after constructing the object and destroy it in case of an error.
-DumpWriter::DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor) :
+// Each dump thread may queue a few buffers ahead of compression and writing.
+DumpWriter::DumpWriter(AbstractWriter* writer, AbstractCompressor* compressor, uint num_dump_threads) :
   AbstractDumpWriter(),
-  _backend(writer, compressor, io_buffer_max_size, io_buffer_max_waste) {
+  _backend(writer, compressor, io_buffer_max_size, io_buffer_max_waste,
+           (size_t)MAX2(num_dump_threads, 1u) * io_buffers_queued_per_thread * io_buffer_max_size) {
   flush();
 }
 
@@ -2364,8 +2371,9 @@ void VM_HeapDumper::work(uint worker_id) {
   dump_large_objects(&obj_dumper);
   // Writes the HPROF_HEAP_DUMP_END record.
   DumperSupport::end_of_dump(writer());
-  // We are done with writing. Release the worker threads.
-  writer()->deactivate();
+  // We are done with writing. Release the worker threads. The data still
+  // queued in the backend is written after the safepoint.
+  writer()->release_threads();
 }
 
 void VM_HeapDumper::dump_stack_traces() {
@@ -2454,7 +2462,7 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     }
   }
 
-  DumpWriter writer(new (std::nothrow) FileWriter(path, overwrite), compressor);
+  DumpWriter writer(new (std::nothrow) FileWriter(path, overwrite), compressor, num_dump_threads);
 
   if (writer.error() != NULL) {
     set_error(writer.error());
@@ -2465,8 +2473,17 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     return -1;
   }
 
+  // The concurrent collectors can't collect from within the dump operation.
+  // Run a concurrent cycle up front instead, so that only the dump itself
+  // has to happen at the safepoint.
+  bool gc_in_dump_operation = _gc_before_heap_dump;
+  if (_gc_before_heap_dump && (UseZGC || UseShenandoahGC) && !Thread::current()->is_VM_thread()) {
+    Universe::heap()->collect(GCCause::_heap_dump);
+    gc_in_dump_operation = false;
+  }
+
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
+  VM_HeapDumper dumper(&writer, gc_in_dump_operation, _oome, num_dump_threads);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -2474,6 +2491,17 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     VMThread::execute(&dumper);
   }
 
+  // Compress and write the data still queued in the backend. This does
+  // not touch the Java heap, so it can be done outside of the safepoint
+  // and in native state, where it does not hold up other safepoints.
+  Thread* current = Thread::current();
+  if (current->is_Java_thread() && JavaThread::cast(current)->thread_state() == _thread_in_vm) {
+    ThreadToNativeFromVM ttn(JavaThread::cast(current));
+    writer.deactivate();
+  } else {
+    writer.deactivate();
+  }
+
   // record any error that the writer may have encountered
   set_error(writer.error());
 
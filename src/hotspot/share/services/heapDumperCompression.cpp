@@ -185,12 +185,15 @@ void WorkList::add_by_id(WriteWork* work) {
 
 
 CompressionBackend::CompressionBackend(AbstractWriter* writer,
-     AbstractCompressor* compressor, size_t block_size, size_t max_waste) :
+     AbstractCompressor* compressor, size_t block_size, size_t max_waste,
+     size_t max_buffered) :
   _active(false),
   _err(NULL),
   _nr_of_threads(0),
   _works_created(0),
+  _max_works((int) (max_buffered / block_size)),
   _work_creation_failed(false),
+  _threads_released(false),
   _id_to_write(0),
   _next_id(0),
   _in_size(block_size),
@@ -269,6 +272,22 @@ void CompressionBackend::deactivate() {
   ml.notify_all();
 }
 
+void CompressionBackend::release_threads() {
+  assert(_active, "Must be active");
+
+  MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+
+  // Queue the last partially filled buffer.
+  if ((_current != NULL) && (_current->_in_used > 0)) {
+    _current->_id = _next_id++;
+    _to_compress.add_last(_current);
+    _current = NULL;
+  }
+
+  _threads_released = true;
+  ml.notify_all();
+}
+
 void CompressionBackend::thread_loop() {
   {
     MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
@@ -368,10 +387,15 @@ void CompressionBackend::do_foreground_work() {
 WriteWork* CompressionBackend::get_work() {
   MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
 
-  while (_active && _to_compress.is_empty()) {
+  while (_active && !_threads_released && _to_compress.is_empty()) {
     ml.wait();
   }
 
+  if (_threads_released) {
+    // Leave the rest of the work to the thread deactivating the backend.
+    return NULL;
+  }
+
   return _to_compress.remove_first();
 }
 
@@ -421,8 +445,10 @@ void CompressionBackend::get_new_buffer(char** buffer, size_t* used, size_t* max
     }
 
     while ((_current == NULL) && _unused.is_empty() && _active) {
-      // Add more work objects if needed.
-      if (!_work_creation_failed && (_works_created <= _nr_of_threads)) {
+      // Add more work objects if needed. Buffering more than one work per
+      // thread lets the dumper run ahead of compression and writing.
+      if (!_work_creation_failed &&
+          ((_works_created <= _nr_of_threads) || (_works_created < _max_works))) {
         WriteWork* work = allocate_work(_in_size, _out_size, _tmp_size);
 
         if (work != NULL) {
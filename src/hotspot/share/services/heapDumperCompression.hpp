@@ -172,7 +172,9 @@ class CompressionBackend : StackObj {
 
   int _nr_of_threads;
   int _works_created;
+  int _max_works;
   bool _work_creation_failed;
+  bool _threads_released;
 
   int64_t _id_to_write;
   int64_t _next_id;
@@ -212,8 +214,10 @@ public:
   // block_size is the buffer size of a WriteWork.
   // max_waste is the maximum number of bytes to leave
   // empty in the buffer when it is written.
+  // max_buffered is the number of bytes which can be queued for
+  // compression and writing before the producer has to wait.
   CompressionBackend(AbstractWriter* writer, AbstractCompressor* compressor,
-    size_t block_size, size_t max_waste);
+    size_t block_size, size_t max_waste, size_t max_buffered);
 
   ~CompressionBackend();
 
@@ -230,6 +234,11 @@ public:
   // The entry point for a worker thread.
   void thread_loop();
 
+  // Queues the current buffer and lets the worker threads leave thread_loop()
+  // without draining the queue. The remaining work is done by the thread
+  // calling deactivate(), which does not need to be at a safepoint.
+  void release_threads();
+
   // Shuts down the backend, releasing all threads.
   void deactivate();
 
@@ -28,7 +28,7 @@
 #include "services/mallocTracker.inline.hpp"
 #include "services/memTracker.hpp"
 
-size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
+ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE) size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
 #ifdef ASSERT
 void MemoryCounter::update_peak_count(size_t count) {
@@ -60,6 +60,46 @@ size_t MemoryCounter::peak_size() const {
 }
 #endif
 
+// Stripe numbers are 1-based so that the zero initial value means unassigned.
+THREAD_LOCAL uint StripedMemoryCounter::_thread_stripe = 0;
+volatile uint StripedMemoryCounter::_next_stripe = 0;
+
+uint StripedMemoryCounter::assign_stripe() {
+  uint index = Atomic::add(&_next_stripe, 1u, memory_order_relaxed) % NumStripes + 1;
+  _thread_stripe = index;
+  return index;
+}
+
+#ifdef ASSERT
+void StripedMemoryCounter::update_peak_count(size_t count) {
+  size_t peak_cnt = peak_count();
+  while (peak_cnt < count) {
+    size_t old_cnt = Atomic::cmpxchg(&_peak_count, peak_cnt, count, memory_order_relaxed);
+    if (old_cnt != peak_cnt) {
+      peak_cnt = old_cnt;
+    }
+  }
+}
+
+void StripedMemoryCounter::update_peak_size(size_t sz) {
+  size_t peak_sz = peak_size();
+  while (peak_sz < sz) {
+    size_t old_sz = Atomic::cmpxchg(&_peak_size, peak_sz, sz, memory_order_relaxed);
+    if (old_sz != peak_sz) {
+      peak_sz = old_sz;
+    }
+  }
+}
+
+size_t StripedMemoryCounter::peak_count() const {
+  return Atomic::load(&_peak_count);
+}
+
+size_t StripedMemoryCounter::peak_size() const {
+  return Atomic::load(&_peak_size);
+}
+#endif
+
 // Total malloc invocation count
 size_t MallocMemorySnapshot::total_count() const {
   size_t amount = 0;
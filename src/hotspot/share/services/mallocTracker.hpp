@@ -28,6 +28,7 @@
 #if INCLUDE_NMT
 
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/nmtCommon.hpp"
@@ -89,6 +90,107 @@ class MemoryCounter {
 #endif // ASSERT
 };
 
+/*
+ * A MemoryCounter for the hot per-type summary counters. The counts and sizes
+ * are spread over a few cache line sized stripes, and each thread updates the
+ * stripe it was assigned on first use, so that threads allocating in the same
+ * category do not all contend on one cache line. A block freed by a different
+ * thread than the one that allocated it makes individual stripes wrap around,
+ * but only their sum is meaningful and that stays exact.
+ */
+class StripedMemoryCounter {
+ private:
+  static const uint NumStripes = 8;
+
+  struct Stripe {
+    volatile size_t _count;
+    volatile size_t _size;
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, 2 * sizeof(size_t));
+  };
+
+  Stripe _stripes[NumStripes];
+
+  DEBUG_ONLY(volatile size_t   _peak_count;)
+  DEBUG_ONLY(volatile size_t   _peak_size; )
+  // Keep the size a multiple of the cache line size, so that the stripes of
+  // consecutive counters stay aligned.
+  DEBUG_ONLY(DEFINE_PAD_MINUS_SIZE(1, DEFAULT_CACHE_LINE_SIZE, 2 * sizeof(size_t));)
+
+  static THREAD_LOCAL uint _thread_stripe;
+  static volatile uint _next_stripe;
+
+  static uint assign_stripe();
+
+  inline Stripe* stripe() {
+    uint index = _thread_stripe;
+    if (index == 0) {
+      index = assign_stripe();
+    }
+    return &_stripes[index - 1];
+  }
+
+ public:
+  StripedMemoryCounter() {
+    for (uint i = 0; i < NumStripes; i++) {
+      _stripes[i]._count = 0;
+      _stripes[i]._size = 0;
+    }
+    DEBUG_ONLY(_peak_count = 0;)
+    DEBUG_ONLY(_peak_size  = 0;)
+  }
+
+  inline void allocate(size_t sz) {
+    Stripe* s = stripe();
+    Atomic::add(&s->_count, size_t(1), memory_order_relaxed);
+    if (sz > 0) {
+      Atomic::add(&s->_size, sz, memory_order_relaxed);
+      DEBUG_ONLY(update_peak_size(size());)
+    }
+    DEBUG_ONLY(update_peak_count(count());)
+  }
+
+  inline void deallocate(size_t sz) {
+    assert(count() > 0, "Nothing allocated yet");
+    assert(size() >= sz, "deallocation > allocated");
+    Stripe* s = stripe();
+    Atomic::dec(&s->_count, memory_order_relaxed);
+    if (sz > 0) {
+      Atomic::sub(&s->_size, sz, memory_order_relaxed);
+    }
+  }
+
+  inline void resize(ssize_t sz) {
+    if (sz != 0) {
+      assert(sz >= 0 || size() >= size_t(-sz), "Must be");
+      Atomic::add(&stripe()->_size, size_t(sz), memory_order_relaxed);
+      DEBUG_ONLY(update_peak_size(size());)
+    }
+  }
+
+  inline size_t count() const {
+    size_t sum = 0;
+    for (uint i = 0; i < NumStripes; i++) {
+      sum += Atomic::load(&_stripes[i]._count);
+    }
+    return sum;
+  }
+
+  inline size_t size() const {
+    size_t sum = 0;
+    for (uint i = 0; i < NumStripes; i++) {
+      sum += Atomic::load(&_stripes[i]._size);
+    }
+    return sum;
+  }
+
+#ifdef ASSERT
+  void update_peak_count(size_t cnt);
+  void update_peak_size(size_t sz);
+  size_t peak_count() const;
+  size_t peak_size()  const;
+#endif // ASSERT
+};
+
 /*
  * Malloc memory used by a particular subsystem.
  * It includes the memory acquired through os::malloc()
@@ -96,8 +198,8 @@ class MemoryCounter {
  */
 class MallocMemory {
  private:
-  MemoryCounter _malloc;
-  MemoryCounter _arena;
+  StripedMemoryCounter _malloc;
+  StripedMemoryCounter _arena;
 
  public:
   MallocMemory() { }
@@ -127,8 +229,8 @@ class MallocMemory {
   inline size_t arena_size()   const { return _arena.size();  }
   inline size_t arena_count()  const { return _arena.count(); }
 
-  DEBUG_ONLY(inline const MemoryCounter& malloc_counter() const { return _malloc; })
-  DEBUG_ONLY(inline const MemoryCounter& arena_counter()  const { return _arena;  })
+  DEBUG_ONLY(inline const StripedMemoryCounter& malloc_counter() const { return _malloc; })
+  DEBUG_ONLY(inline const StripedMemoryCounter& arena_counter()  const { return _arena;  })
 };
 
 class MallocMemorySummary;
@@ -139,8 +241,8 @@ class MallocMemorySnapshot : public ResourceObj {
   friend class MallocMemorySummary;
 
  private:
-  MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _tracking_header;
+  MallocMemory         _malloc[mt_number_of_types];
+  StripedMemoryCounter _tracking_header;
 
 
  public:
@@ -149,7 +251,7 @@ class MallocMemorySnapshot : public ResourceObj {
     return &_malloc[index];
   }
 
-  inline MemoryCounter* malloc_overhead() {
+  inline StripedMemoryCounter* malloc_overhead() {
     return &_tracking_header;
   }
 
@@ -186,8 +288,9 @@ class MallocMemorySnapshot : public ResourceObj {
  */
 class MallocMemorySummary : AllStatic {
  private:
-  // Reserve memory for placement of MallocMemorySnapshot object
-  static size_t _snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
+  // Reserve memory for placement of MallocMemorySnapshot object. Aligned so
+  // that the stripes of the counters really are on separate cache lines.
+  ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE) static size_t _snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
  public:
    static void initialize();
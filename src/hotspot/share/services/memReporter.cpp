@@ -281,7 +281,11 @@ int MemDetailReporter::report_malloc_sites() {
       continue;
     }
     const NativeCallStack* stack = malloc_site->call_stack();
-    stack->print_on(out);
+    if (stack->is_empty()) {
+      out->print_cr("[unknown or unsampled call stacks]");
+    } else {
+      stack->print_on(out);
+    }
     out->print("%29s", " ");
     MEMFLAGS flag = malloc_site->flag();
     assert(NMTUtil::flag_is_valid(flag) && flag != mtNone,
@@ -774,7 +778,11 @@ void MemDetailDiffReporter::diff_malloc_site(const NativeCallStack* stack, size_
       return;
   }
 
-  stack->print_on(out);
+  if (stack->is_empty()) {
+    out->print_cr("[unknown or unsampled call stacks]");
+  } else {
+    stack->print_on(out);
+  }
   out->print("%28s (", " ");
   print_malloc_diff(current_size, current_count,
     early_size, early_count, flags);
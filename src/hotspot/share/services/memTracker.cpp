@@ -51,6 +51,8 @@ NMT_TrackingLevel MemTracker::_cmdline_tracking_level = NMT_unknown;
 
 MemBaseline MemTracker::_baseline;
 
+THREAD_LOCAL uint MemTracker::_stack_sample_countdown = 0;
+
 void MemTracker::initialize() {
   bool rc = true;
   assert(_tracking_level == NMT_unknown, "only call once");
@@ -33,6 +33,7 @@
 
 #define CURRENT_PC   NativeCallStack::empty_stack()
 #define CALLER_PC    NativeCallStack::empty_stack()
+#define MALLOC_CALLER_PC NativeCallStack::empty_stack()
 
 class Tracker : public StackObj {
  public:
@@ -80,6 +81,7 @@ class MemTracker : AllStatic {
 
 #else
 
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/mallocTracker.hpp"
@@ -91,6 +93,12 @@ class MemTracker : AllStatic {
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : NativeCallStack::empty_stack())
 
+// Like CALLER_PC, but subject to NMTStackSamplingInterval. Only used by the
+// generic malloc entry points; virtual memory regions always record a stack.
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail &&     \
+                           MemTracker::should_capture_stack()) ?             \
+                          NativeCallStack(1) : NativeCallStack::empty_stack())
+
 class MemBaseline;
 
 // Tracker is used for guarding 'release' semantics of virtual memory operation, to avoid
@@ -145,6 +153,22 @@ class MemTracker : AllStatic {
   // Transition the tracking level to specified level
   static bool transition_to(NMT_TrackingLevel level);
 
+  // In detail mode, walking the native stack dominates the cost of a
+  // tracked allocation. With NMTStackSamplingInterval > 1 only every n-th
+  // malloc of a thread through MALLOC_CALLER_PC records its call stack; the
+  // others are accounted to the empty call stack site.
+  static inline bool should_capture_stack() {
+    if (NMTStackSamplingInterval <= 1) {
+      return true;
+    }
+    if (_stack_sample_countdown == 0) {
+      _stack_sample_countdown = NMTStackSamplingInterval - 1;
+      return true;
+    }
+    _stack_sample_countdown--;
+    return false;
+  }
+
   static inline void* record_malloc(void* mem_base, size_t size, MEMFLAGS flag,
     const NativeCallStack& stack, NMT_TrackingLevel level) {
     if (level != NMT_off) {
@@ -320,6 +344,8 @@ class MemTracker : AllStatic {
   static MemBaseline      _baseline;
   // Query lock
   static Mutex*           _query_lock;
+  // Allocations left until this thread captures its next call stack
+  static THREAD_LOCAL uint _stack_sample_countdown;
 };
 
 #endif // INCLUDE_NMT
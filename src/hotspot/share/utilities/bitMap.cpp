@@ -631,7 +631,10 @@ BitMap::idx_t BitMap::count_one_bits_in_range_of_words(idx_t beg_full_word, idx_
   idx_t sum = 0;
   for (idx_t i = beg_full_word; i < end_full_word; i++) {
     bm_word_t w = map()[i];
-    sum += population_count(w);
+    // Marking bitmaps are typically sparse; skip the popcount for empty words.
+    if (w != 0) {
+      sum += population_count(w);
+    }
   }
   return sum;
 }
@@ -29,9 +29,11 @@
 #include "memory/allocation.inline.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(NULL), _fd(file), _section(file, shdr) {
+  _next(NULL), _fd(file), _section(file, shdr),
+  _index(NULL), _index_length(0), _index_max_size(0), _index_built(false) {
   assert(file != NULL, "null file handle");
   _status = _section.status();
 
@@ -44,6 +46,60 @@ ElfSymbolTable::~ElfSymbolTable() {
   if (_next != NULL) {
     delete _next;
   }
+  if (_index != NULL) {
+    os::free(_index);
+  }
+}
+
+int ElfSymbolTable::compare_index_entries(const IndexEntry& a, const IndexEntry& b) {
+  if (a._addr != b._addr) {
+    return a._addr < b._addr ? -1 : 1;
+  }
+  return a._sym - b._sym;
+}
+
+void ElfSymbolTable::build_index(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable) {
+  _index_built = true;
+
+  int length = 0;
+  for (int index = 0; index < count; index++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size != 0) {
+      length++;
+    }
+  }
+  if (length == 0) {
+    return;
+  }
+
+  // Failing to allocate is fine, lookups then keep scanning the section.
+  IndexEntry* entries = (IndexEntry*)os::malloc(sizeof(IndexEntry) * length, mtInternal);
+  if (entries == NULL) {
+    return;
+  }
+
+  Elf_Word max_size = 0;
+  int pos = 0;
+  for (int index = 0; index < count; index++) {
+    const Elf_Sym* sym = &symbols[index];
+    if (STT_FUNC == ELF_ST_TYPE(sym->st_info) && sym->st_size != 0) {
+      address sym_addr;
+      if (funcDescTable != NULL && funcDescTable->get_index() == sym->st_shndx) {
+        sym_addr = funcDescTable->lookup(sym->st_value);
+      } else {
+        sym_addr = (address)sym->st_value;
+      }
+      entries[pos]._addr = sym_addr;
+      entries[pos]._size = (Elf_Word)sym->st_size;
+      entries[pos]._sym = index;
+      max_size = MAX2(max_size, entries[pos]._size);
+      pos++;
+    }
+  }
+  QuickSort::sort(entries, length, compare_index_entries, false);
+
+  _index = entries;
+  _index_length = length;
+  _index_max_size = max_size;
 }
 
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
@@ -81,6 +137,38 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != NULL) {
+    if (!_index_built) {
+      build_index(symbols, count, funcDescTable);
+    }
+    if (_index != NULL) {
+      // Find the first entry starting above addr, then walk back over the
+      // entries that could still contain addr. Of those, pick the one that
+      // comes first in the section, as the linear scan does.
+      int lo = 0;
+      int hi = _index_length;
+      while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (_index[mid]._addr <= addr) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      int found = -1;
+      for (int i = lo - 1; i >= 0; i--) {
+        const IndexEntry* e = &_index[i];
+        if ((size_t)(addr - e->_addr) >= (size_t)_index_max_size) {
+          break;
+        }
+        if ((Elf_Word)(addr - e->_addr) < e->_size && (found == -1 || e->_sym < found)) {
+          found = e->_sym;
+        }
+      }
+      if (found == -1) {
+        return false;
+      }
+      return compare(&symbols[found], addr, stringtableIndex, posIndex, offset, funcDescTable);
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
@@ -50,6 +50,22 @@ private:
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // Function symbols sorted by address, built on first lookup when the
+  // symbols are held in memory. Decoding many addresses (error reports,
+  // NMT detail) then costs a binary search instead of a scan each.
+  struct IndexEntry {
+    address   _addr;
+    Elf_Word  _size;
+    int       _sym;    // position in the symbol section
+  };
+  IndexEntry*     _index;
+  int             _index_length;
+  Elf_Word        _index_max_size;
+  bool            _index_built;
+
+  void build_index(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable);
+  static int compare_index_entries(const IndexEntry& a, const IndexEntry& b);
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
@@ -194,6 +194,11 @@ public:
   E  next() { return *next_addr(); }
   E* next_addr();
 
+  // Return the elements of the current segment, starting with the oldest,
+  // and advance to the next segment. The number of elements is returned in
+  // seg_size.
+  E* next_segment(size_t& seg_size);
+
   void sync(); // Sync the iterator's state to the stack's current state.
 
 private:
@@ -328,7 +328,18 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
                          bool version_leq_47) {
   int i = 0;
-  int count = length >> 2;
+  // Skip over leading ASCII eight bytes at a time. For a word w,
+  // ((w - 0x01..01) | w) & 0x80..80 is zero iff every byte is in 1..127:
+  // a subtraction borrow can only start at a zero byte, which is flagged
+  // by itself, so any flag means there is a byte to check individually.
+  const uint64_t ones = UCONST64(0x0101010101010101);
+  const uint64_t highs = UCONST64(0x8080808080808080);
+  for (; i + 8 <= length; i += 8) {
+    uint64_t w;
+    memcpy(&w, buffer + i, sizeof(w));
+    if ((((w - ones) | w) & highs) != 0) break;
+  }
+  int count = (length - i) >> 2;
   for (int k=0; k<count; k++) {
     unsigned char b0 = buffer[i];
     unsigned char b1 = buffer[i+1];
@@ -459,10 +470,33 @@ char* UNICODE::as_utf8(const jchar* base, int length, char* buf, int buflen) {
   return buf;
 }
 
+// Returns true if all eight bytes of w are ASCII characters that are encoded
+// as themselves in modified UTF8, i.e., in the range [0x01, 0x7f].
+static inline bool is_plain_ascii(uint64_t w) {
+  const uint64_t ones = UCONST64(0x0101010101010101);
+  const uint64_t highs = UCONST64(0x8080808080808080);
+  // No byte has its high bit set, and no byte is zero.
+  return (w & highs) == 0 && ((w - ones) & ~w & highs) == 0;
+}
+
 char* UNICODE::as_utf8(const jbyte* base, int length, char* buf, int buflen) {
   assert(buflen > 0, "zero length output buffer");
   u_char* p = (u_char*)buf;
-  for (int index = 0; index < length; index++) {
+  int index = 0;
+  // Copy runs of plain ASCII characters eight at a time, as long as there is
+  // room for them and the terminating zero.
+  while (index + 8 <= length && buflen > 8) {
+    uint64_t w;
+    memcpy(&w, base + index, sizeof(w));
+    if (!is_plain_ascii(w)) {
+      break;
+    }
+    memcpy(p, &w, sizeof(w));
+    p += 8;
+    index += 8;
+    buflen -= 8;
+  }
+  for (; index < length; index++) {
     jbyte c = base[index];
     int sz = utf8_size(c);
     buflen -= sz;
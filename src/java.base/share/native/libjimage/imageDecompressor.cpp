@@ -166,8 +166,13 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
         compressed_resource += 1;
         has_header = _header._magic == ResourceHeader::resource_header_magic;
         if (has_header) {
+            // The last decompressor in the stack produces the resource itself,
+            // so decompress directly into the caller's buffer whenever the
+            // result fits, and only move it aside if it carries another header.
+            bool in_place = _header._uncompressed_size <= uncompressed_size;
             // decompressed_resource array contains the result of decompression
-            decompressed_resource = new u1[(size_t) _header._uncompressed_size];
+            decompressed_resource = in_place ? uncompressed :
+                    new u1[(size_t) _header._uncompressed_size];
             // Retrieve the decompressor name
             const char* decompressor_name = strings->get(_header._decompressor_name_offset);
             assert(decompressor_name && "image decompressor not found");
@@ -180,11 +185,19 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
             if (compressed_resource_base != compressed) {
                 delete[] compressed_resource_base;
             }
+            if (in_place && _header._uncompressed_size >= 4 &&
+                    getU4(uncompressed, endian) == ResourceHeader::resource_header_magic) {
+                // Not the final stage, the next one will write into uncompressed.
+                decompressed_resource = new u1[(size_t) _header._uncompressed_size];
+                memcpy(decompressed_resource, uncompressed, (size_t) _header._uncompressed_size);
+            }
             compressed_resource = decompressed_resource;
         }
     } while (has_header);
-    memcpy(uncompressed, decompressed_resource, (size_t) uncompressed_size);
-    delete[] decompressed_resource;
+    if (decompressed_resource != uncompressed) {
+        memcpy(uncompressed, decompressed_resource, (size_t) uncompressed_size);
+        delete[] decompressed_resource;
+    }
 }
 
 // Zip decompressor
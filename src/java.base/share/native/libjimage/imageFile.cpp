@@ -565,6 +565,23 @@ void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_dat
     }
 }
 
+// Return the address of the resource for the supplied location offset, if the
+// resource can be used in place.
+const u1* ImageFileReader::get_resource_address(u4 offset) const {
+    if (!memory_map_image) {
+        return NULL;
+    }
+    // Get address of first byte of location attribute stream.
+    u1* data = get_location_offset_data(offset);
+    // Expand location attributes.
+    ImageLocation location(data);
+    // Compressed resources have to be expanded into a buffer.
+    if (location.get_attribute(ImageLocation::ATTRIBUTE_COMPRESSED) != 0) {
+        return NULL;
+    }
+    return get_data_address() + location.get_attribute(ImageLocation::ATTRIBUTE_OFFSET);
+}
+
 // Return the ImageModuleData for this image
 ImageModuleData * ImageFileReader::get_image_module_data() {
     return _module_data;
@@ -578,6 +578,11 @@ public:
     // Return the resource for the supplied path.
     void get_resource(ImageLocation& location, u1* uncompressed_data) const;
 
+    // Return the address of the resource for the supplied location offset in
+    // the mapped image, or NULL if the image is not memory mapped or the
+    // resource is compressed.
+    const u1* get_resource_address(u4 offset) const;
+
     // Return the ImageModuleData for this image
     ImageModuleData * get_image_module_data();
 
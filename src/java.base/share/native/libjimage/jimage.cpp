@@ -162,6 +162,19 @@ JIMAGE_GetResource(JImageFile* image, JImageLocationRef location,
     return size;
 }
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and a
+ * resource's location information (see JImageFindResource), return the address
+ * of the resource bytes in the memory mapped image, or NULL if the resource
+ * has to be read with JImageGetResource (the image is not memory mapped or the
+ * resource is compressed). The returned memory is valid until the image is
+ * closed and must not be modified.
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* image, JImageLocationRef location) {
+    return (const char*) ((ImageFileReader*) image)->get_resource_address((u4) location);
+}
+
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
  * function and a visitor argument, iterator through each of the image's resources.
@@ -158,6 +158,25 @@ typedef jlong(*JImageGetResource_t)(JImageFile* jimage, JImageLocationRef locati
         char* buffer, jlong size);
 
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and a
+ * resource's location information (see JImageFindResource), return the address
+ * of the resource bytes in the memory mapped image, or NULL if the resource
+ * has to be read with JImageGetResource (the image is not memory mapped or the
+ * resource is compressed). The returned memory is valid until the image is
+ * closed and must not be modified.
+ *
+ * Ex.
+ *  jlong size;
+ *  JImageLocationRef location = (*JImageFindResource)(image,
+ *                               "java.base", "9.0", "java/lang/String.class", &size);
+ *  const char* data = (*JImageGetResourceAddress)(image, location);
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* jimage, JImageLocationRef location);
+
+typedef const char*(*JImageGetResourceAddress_t)(JImageFile* jimage, JImageLocationRef location);
+
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
  * function and a visitor argument, iterator through each of the image's resources.
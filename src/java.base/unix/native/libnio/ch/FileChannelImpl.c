@@ -30,6 +30,7 @@
 #include <unistd.h>
 
 #if defined(__linux__)
+#include <dlfcn.h>
 #include <sys/sendfile.h>
 #elif defined(_AIX)
 #include <string.h>
@@ -52,11 +53,22 @@
 
 static jfieldID chan_fd;        /* jobject 'fd' in sun.nio.ch.FileChannelImpl */
 
+#if defined(__linux__)
+typedef ssize_t copy_file_range_func(int, loff_t*, int, loff_t*, size_t,
+                                     unsigned int);
+static copy_file_range_func* my_copy_file_range_func = NULL;
+#endif
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileChannelImpl_initIDs(JNIEnv *env, jclass clazz)
 {
     jlong pageSize = sysconf(_SC_PAGESIZE);
     chan_fd = (*env)->GetFieldID(env, clazz, "fd", "Ljava/io/FileDescriptor;");
+#if defined(__linux__)
+    // copy_file_range(2) is only available in glibc 2.27 and later
+    my_copy_file_range_func =
+        (copy_file_range_func*) dlsym(RTLD_DEFAULT, "copy_file_range");
+#endif
     return pageSize;
 }
 
@@ -169,7 +181,39 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 
 #if defined(__linux__)
     off64_t offset = (off64_t)position;
-    jlong n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
+    jlong n;
+
+    // For file-to-file transfers copy_file_range lets the kernel copy
+    // (or reflink) the data directly. It fails with EINVAL when the target
+    // is not a regular file, in which case, and whenever it is otherwise
+    // unsupported for the given pair of files, fall back to sendfile.
+    // Some pseudo file systems such as procfs and sysfs report a source
+    // size of zero, so copy_file_range copies nothing and returns 0 even
+    // though data is available; let sendfile retry the transfer then.
+    if (my_copy_file_range_func != NULL) {
+        loff_t src_offset = (loff_t)position;
+        n = my_copy_file_range_func(srcFD, &src_offset, dstFD, NULL,
+                                    (size_t)count, 0);
+        if (n > 0)
+            return n;
+        if (n < 0) {
+            switch (errno) {
+                case EINTR:
+                    return IOS_INTERRUPTED;
+                case EBADF:     // target opened with O_APPEND
+                case EINVAL:
+                case ENOSYS:
+                case EOPNOTSUPP:
+                case EXDEV:     // cross-filesystem copy on older kernels
+                    break;
+                default:
+                    JNU_ThrowIOExceptionWithLastError(env, "Copy failed");
+                    return IOS_THROWN;
+            }
+        }
+    }
+
+    n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
@@ -123,6 +123,8 @@ typedef jint    IntArgbPreDataType;
     do { \
         if ((((argb) >> 24) + 1) == 0) { \
             (pRas)[x] = (argb); \
+        } else if (((argb) >> 24) == 0) { \
+            (pRas)[x] = 0; \
         } else { \
             jint a, r, g, b; \
             ExtractIntDcmComponents1234(argb, a, r, g, b); \
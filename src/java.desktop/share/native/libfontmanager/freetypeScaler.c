@@ -78,6 +78,8 @@ typedef struct {
     unsigned fontDataOffset;
     unsigned fontDataLength;
     unsigned fileSize;
+
+    int faceSize;            /* size last set on face, 0 if not set yet */
 } FTScalerInfo;
 
 typedef struct FTScalerContext {
@@ -591,10 +593,19 @@ static int setupFTContext(JNIEnv *env,
         setupTransform(&matrix, context);
         FT_Set_Transform(scalerInfo->face, &matrix, NULL);
 
-        errCode = FT_Set_Char_Size(scalerInfo->face, 0, context->ptsz, 72, 72);
+        /* Changing the size resets the scaled metrics and, for hinted
+           TrueType fonts, forces the prep program to run again, so only
+           do it when switching to a different strike size. */
+        if (scalerInfo->faceSize != context->ptsz) {
+            scalerInfo->faceSize = 0;
+            errCode = FT_Set_Char_Size(scalerInfo->face, 0, context->ptsz, 72, 72);
 
-        if (errCode == 0) {
-            errCode = FT_Activate_Size(scalerInfo->face->size);
+            if (errCode == 0) {
+                errCode = FT_Activate_Size(scalerInfo->face->size);
+            }
+            if (errCode == 0) {
+                scalerInfo->faceSize = context->ptsz;
+            }
         }
 
         FT_Library_SetLcdFilter(scalerInfo->library, FT_LCD_FILTER_DEFAULT);
@@ -101,6 +101,8 @@ struct core_data {
    // part of the class sharing workaround
    map_info*          class_share_maps;// class share maps in a linked list
    map_info**         map_array; // sorted (by vaddr) array of map_info pointers
+   char*              core_base; // core file mapped read-only, NULL if not mapped
+   size_t             core_size; // size of the mapped core file
 };
 
 struct ps_prochandle {
@@ -30,6 +30,8 @@
 #include <stddef.h>
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "libproc_impl.h"
 #include "ps_core_common.h"
 #include "proc_service.h"
@@ -124,7 +126,15 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
       len = MIN(resid, mp->memsz - mapoff);
       off = mp->offset + mapoff;
 
-      if ((len = pread(fd, buf, len, off)) <= 0) {
+      if (fd == ph->core->core_fd && ph->core->core_base != NULL) {
+         // copy straight out of the mapped core file instead of
+         // issuing a pread per page
+         if (off >= (off_t)ph->core->core_size) {
+            break;
+         }
+         len = MIN(len, (ssize_t)(ph->core->core_size - off));
+         memcpy(buf, ph->core->core_base + off, len);
+      } else if ((len = pread(fd, buf, len, off)) <= 0) {
          break;
       }
 
@@ -175,8 +185,39 @@ static bool core_get_lwp_regs(struct ps_prochandle* ph, lwpid_t lwp_id,
    return false;
 }
 
+// map the whole core file read-only so that reads of the (potentially huge)
+// heap do not need a system call each. If the file cannot be mapped, for
+// example because it does not fit into a 32-bit address space, reads fall
+// back to pread.
+static void map_core_file(struct ps_prochandle* ph) {
+   struct stat st;
+   void* base;
+
+   if (fstat(ph->core->core_fd, &st) != 0 || st.st_size <= 0) {
+      return;
+   }
+   if ((unsigned long long) st.st_size > (size_t)-1) {
+      return;
+   }
+   base = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, ph->core->core_fd, 0);
+   if (base == MAP_FAILED) {
+      print_debug("can't mmap core file, falling back to pread\n");
+      return;
+   }
+   ph->core->core_base = (char*) base;
+   ph->core->core_size = (size_t) st.st_size;
+}
+
+static void core_release_mapped(struct ps_prochandle* ph) {
+   if (ph->core->core_base != NULL) {
+      munmap(ph->core->core_base, ph->core->core_size);
+      ph->core->core_base = NULL;
+   }
+   core_release(ph);
+}
+
 static ps_prochandle_ops core_ops = {
-   .release=  core_release,
+   .release=  core_release_mapped,
    .p_pread=  core_read_data,
    .p_pwrite= core_write_data,
    .get_lwp_regs= core_get_lwp_regs
@@ -761,6 +802,8 @@ Pgrab_core(const char* exec_file, const char* core_file) {
     goto err;
   }
 
+  map_core_file(ph);
+
   if ((ph->core->exec_fd = open(exec_file, O_RDONLY)) < 0) {
     print_debug("can't open executable file\n");
     goto err;
@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "threadHelper.inline.hpp"
 #include "unittest.hpp"
@@ -145,3 +146,20 @@ public:
 TEST_VM(SymbolTable, test_symbol_refcount_parallel) {
   mt_test_doer<DriverSymbolThread>();
 }
+
+TEST(SymbolTable, hash_code_matches_string_hash) {
+  const char* str = "java/lang/invoke/MethodHandleNatives$\xc3\xa9";
+  const int len = (int)strlen(str);
+  // Compare against the String.hashCode() definition for every prefix, so
+  // that all remainders of the unrolled loop are covered.
+  for (int n = 0; n <= len; n++) {
+    unsigned int h = 0;
+    jchar chars[64];
+    for (int i = 0; i < n; i++) {
+      h = 31 * h + ((unsigned int)str[i] & 0xFF);
+      chars[i] = (jchar)(str[i] & 0xFF);
+    }
+    EXPECT_EQ(h, java_lang_String::hash_code((const jbyte*)str, n)) << "length " << n;
+    EXPECT_EQ(h, java_lang_String::hash_code(chars, n)) << "length " << n;
+  }
+}
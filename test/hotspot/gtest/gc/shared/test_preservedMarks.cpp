@@ -86,3 +86,27 @@ TEST_VM(PreservedMarks, iterate_and_restore) {
   ASSERT_MARK_WORD_EQ(o3.mark(), FakeOop::changedMark());
   ASSERT_MARK_WORD_EQ(o4.mark(), FakeOop::changedMark());
 }
+
+TEST_VM(PreservedMarksSet, restore_multiple_segments) {
+  // Enough objects to fill several stack segments in the first set.
+  const size_t num_oops = 600;
+  FakeOop oops[num_oops];
+
+  PreservedMarksSet pms(true /* in_c_heap */);
+  pms.init(2);
+
+  for (size_t i = 0; i < num_oops; i++) {
+    oops[i].set_mark(FakeOop::changedMark());
+    // Put almost all marks in the first stack.
+    PreservedMarks* pm = pms.get(i % 100 == 0 ? 1 : 0);
+    pm->push(oops[i].get_oop(), oops[i].mark());
+    oops[i].set_mark(FakeOop::originalMark());
+  }
+
+  pms.restore(nullptr);
+  for (size_t i = 0; i < num_oops; i++) {
+    ASSERT_MARK_WORD_EQ(oops[i].mark(), FakeOop::changedMark());
+  }
+
+  pms.reclaim();
+}
@@ -68,76 +68,54 @@ LOG_LEVEL_LIST
   }
 };
 
-TEST_VM(AsyncLogBufferTest, fifo) {
-  LinkedListDeque<int, mtLogging> fifo;
-  LinkedListImpl<int, ResourceObj::C_HEAP, mtLogging> result;
-
-  fifo.push_back(1);
-  EXPECT_EQ((size_t)1, fifo.size());
-  EXPECT_EQ(1, *(fifo.back()));
-
-  fifo.pop_all(&result);
-  EXPECT_EQ((size_t)0, fifo.size());
-  EXPECT_EQ(NULL, fifo.back());
-  EXPECT_EQ((size_t)1, result.size());
-  EXPECT_EQ(1, *(result.head()->data()));
-  result.clear();
-
-  fifo.push_back(2);
-  fifo.push_back(1);
-  fifo.pop_all(&result);
-  EXPECT_EQ((size_t)2, result.size());
-  EXPECT_EQ(2, *(result.head()->data()));
-  EXPECT_EQ(1, *(result.head()->next()->data()));
-  result.clear();
-  const int N = 1000;
-  for (int i=0; i<N; ++i) {
-    fifo.push_back(i);
-  }
-  fifo.pop_all(&result);
+TEST_VM_F(AsyncLogTest, logBuffer) {
+  using none = LogTagSetMapping<LogTag::__NO_TAG>;
+  LogDecorations decorations(LogLevel::Warning, none::tagset(), LogDecorators());
 
-  EXPECT_EQ((size_t)N, result.size());
-  LinkedListIterator<int> it(result.head());
-  for (int i=0; i<N; ++i) {
-    int* e = it.next();
-    EXPECT_EQ(i, *e);
-  }
-}
+  size_t len = strlen(TestLogFileName) + strlen(LogFileOutput::Prefix) + 1;
+  char* name = NEW_C_HEAP_ARRAY(char, len, mtLogging);
+  snprintf(name, len, "%s%s", LogFileOutput::Prefix, TestLogFileName);
 
-TEST_VM(AsyncLogBufferTest, deque) {
-  LinkedListDeque<int, mtLogging> deque;
-  const int N = 10;
-
-  EXPECT_EQ(NULL, deque.front());
-  EXPECT_EQ(NULL, deque.back());
-  for (int i = 0; i < N; ++i) {
-    deque.push_back(i);
-  }
+  LogFileOutput* output = new LogFileOutput(name);
+  output->initialize(nullptr, nullptr);
+  AsyncLogWriter::Buffer* buffer = new AsyncLogWriter::Buffer(1024);
 
-  EXPECT_EQ(0, *(deque.front()));
-  EXPECT_EQ(N-1, *(deque.back()));
-  EXPECT_EQ((size_t)N, deque.size());
+  EXPECT_FALSE(buffer->iterator().has_next());
 
-  deque.pop_front();
-  EXPECT_EQ((size_t)(N - 1), deque.size());
-  EXPECT_EQ(1, *(deque.front()));
-  EXPECT_EQ(N - 1, *(deque.back()));
+  const char* hello = "hello";
+  const size_t hello_size = AsyncLogWriter::Message::calc_size(strlen(hello));
+  const size_t token_size = AsyncLogWriter::Message::calc_size(0);
+  const size_t hello_count = (1024 - token_size) / hello_size;
 
-  deque.pop_front();
-  EXPECT_EQ((size_t)(N - 2), deque.size());
-  EXPECT_EQ(2, *(deque.front()));
-  EXPECT_EQ(N - 1, *(deque.back()));
-
-
-  for (int i=2; i < N-1; ++i) {
-    deque.pop_front();
+  for (size_t i = 0; i < hello_count; ++i) {
+    EXPECT_TRUE(buffer->push_back(output, decorations, hello));
   }
-  EXPECT_EQ((size_t)1, deque.size());
-  EXPECT_EQ(N - 1, *(deque.back()));
-  EXPECT_EQ(deque.back(), deque.front());
-
-  deque.pop_front();
-  EXPECT_EQ((size_t)0, deque.size());
+  // No more room for messages, but there is always room for a flush token.
+  EXPECT_FALSE(buffer->push_back(output, decorations, hello));
+  buffer->push_flush_token();
+
+  AsyncLogWriter::Buffer::Iterator it = buffer->iterator();
+  for (size_t i = 0; i < hello_count; ++i) {
+    EXPECT_TRUE(it.has_next());
+    const AsyncLogWriter::Message* e = it.next();
+    EXPECT_FALSE(e->is_token());
+    EXPECT_EQ(output, e->output());
+    EXPECT_STREQ(hello, e->message());
+    EXPECT_EQ(hello_size, e->size());
+  }
+  EXPECT_TRUE(it.has_next());
+  const AsyncLogWriter::Message* token = it.next();
+  EXPECT_TRUE(token->is_token());
+  EXPECT_STREQ("", token->message());
+  EXPECT_FALSE(it.has_next());
+
+  buffer->reset();
+  EXPECT_FALSE(buffer->iterator().has_next());
+  EXPECT_TRUE(buffer->push_back(output, decorations, hello));
+
+  delete output; // close file
+  FREE_C_HEAP_ARRAY(char, name);
+  delete buffer;
 }
 
 TEST_VM_F(AsyncLogTest, asynclog) {
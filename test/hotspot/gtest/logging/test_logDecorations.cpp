@@ -208,6 +208,34 @@ TEST(LogDecorations, iso8601_utctime) {
       << ", expected time: " << expected_ts;
 }
 
+// Test that cached time decorations match os::iso8601_time within a second
+// and across second boundaries, in both directions
+TEST(LogDecorations, iso8601_time_repeated) {
+  const jlong second_start = os::javaTimeMillis() / MILLIUNITS * MILLIUNITS;
+  const jlong offsets[] = { 0, 1, 9, 10, 99, 100, 999, 1000, 1001, 1999, 500, 2000, 0 };
+  const bool utc[] = { false, true };
+  for (uint i = 0; i < ARRAY_SIZE(utc); i++) {
+    for (uint j = 0; j < ARRAY_SIZE(offsets); j++) {
+      const jlong millis = second_start + offsets[j];
+      char cached[os::iso8601_timestamp_size];
+      char expected[os::iso8601_timestamp_size];
+      const char* result = LogDecorations::iso8601_time(millis, cached, sizeof(cached), utc[i]);
+      ASSERT_NE((const char*)NULL, result);
+      ASSERT_NE((char*)NULL, os::iso8601_time(millis, expected, sizeof(expected), utc[i]));
+      EXPECT_STREQ(expected, result) << "millis: " << millis << ", utc: " << utc[i];
+    }
+  }
+}
+
+// Test that a buffer too small for a timestamp is rejected, also when the
+// timestamp of the second is cached
+TEST(LogDecorations, iso8601_time_short_buffer) {
+  const jlong millis = os::javaTimeMillis();
+  char buf[os::iso8601_timestamp_size];
+  ASSERT_NE((const char*)NULL, LogDecorations::iso8601_time(millis, buf, sizeof(buf), false));
+  EXPECT_EQ((const char*)NULL, LogDecorations::iso8601_time(millis, buf, sizeof(buf) - 1, false));
+}
+
 // Test the pid and tid decorations
 TEST(LogDecorations, identifiers) {
   char buf[LogDecorations::max_decoration_size + 1];
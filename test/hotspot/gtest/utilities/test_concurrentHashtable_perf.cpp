@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+// This "test" doesn't really verify much.  Rather, it's mostly a
+// microbenchmark for concurrent ConcurrentHashTable access.  It runs a
+// read-mostly mix of lookups, inserts and removes with varying numbers of
+// threads on a prefilled table, and prints the throughput together with
+// percentiles of the per-batch latency.
+
+const uint   _max_threads      = 8;
+const size_t _prefill_entries  = 1 << 16;
+const uint   _batch_size       = 256;
+const uint   _update_percent   = 5;
+const jlong  _warmup_millis    = 100;
+const jlong  _measure_millis   = 400;
+const size_t _max_batches      = 64 * K;
+
+class PerfConfig : public AllStatic {
+public:
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)(value + 1) * (uintx)0x9E3779B1;
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return AllocateHeap(size, mtInternal);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    FreeHeap(memory);
+  }
+};
+
+typedef ConcurrentHashTable<PerfConfig, mtInternal> PerfTable;
+
+struct PerfLookup {
+  uintptr_t _val;
+  PerfLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    return PerfConfig::get_hash(_val, NULL);
+  }
+  bool equals(const uintptr_t* value, bool* is_dead) {
+    return _val == *value;
+  }
+};
+
+struct PerfGet {
+  uintptr_t _value;
+  PerfGet() : _value(0) {}
+  void operator()(uintptr_t* value) {
+    _value = *value;
+  }
+};
+
+static int compare_jlong(const jlong& a, const jlong& b) {
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// Owned by the test, since the test threads delete themselves on exit.
+struct CHTPerfResult {
+  jlong* _batch_nanos;
+  size_t _batches;
+};
+
+class CHTPerfThread : public JavaTestThread {
+  PerfTable* _cht;
+  uintptr_t _private_base;
+  uint32_t _seed;
+  CHTPerfResult* _result;
+
+  uint32_t next_random() {
+    // xorshift32, so that threads do not contend on a shared generator.
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 17;
+    _seed ^= _seed << 5;
+    return _seed;
+  }
+
+  void run_batch() {
+    for (uint i = 0; i < _batch_size; i++) {
+      uint32_t r = next_random();
+      if (r % 100 < _update_percent) {
+        // Updates use a key range private to this thread.
+        PerfLookup lookup(_private_base + (r >> 8) % _batch_size);
+        if (!_cht->remove(this, lookup)) {
+          _cht->insert(this, lookup, lookup._val);
+        }
+      } else {
+        PerfLookup lookup((r >> 8) % _prefill_entries);
+        PerfGet get;
+        _cht->get(this, lookup, get);
+      }
+    }
+  }
+
+public:
+  CHTPerfThread(PerfTable* cht, uint id, CHTPerfResult* result, Semaphore* post) :
+    JavaTestThread(post), _cht(cht),
+    _private_base(_prefill_entries + (uintptr_t)id * _batch_size),
+    _seed(id * 2654435761u + 1), _result(result) {}
+
+  virtual ~CHTPerfThread() {}
+
+  void main_run() {
+    jlong stop = os::javaTimeMillis() + _warmup_millis;
+    while (os::javaTimeMillis() < stop) {
+      run_batch();
+    }
+
+    stop = os::javaTimeMillis() + _measure_millis;
+    size_t batches = 0;
+    while (batches < _max_batches && os::javaTimeMillis() < stop) {
+      jlong start = os::javaTimeNanos();
+      run_batch();
+      _result->_batch_nanos[batches++] = os::javaTimeNanos() - start;
+    }
+    _result->_batches = batches;
+  }
+};
+
+static void report(uint nthreads, const CHTPerfResult* results) {
+  size_t total = 0;
+  for (uint i = 0; i < nthreads; i++) {
+    total += results[i]._batches;
+  }
+  if (total == 0) {
+    return;
+  }
+
+  jlong* all = NEW_C_HEAP_ARRAY(jlong, total, mtInternal);
+  size_t pos = 0;
+  for (uint i = 0; i < nthreads; i++) {
+    memcpy(all + pos, results[i]._batch_nanos, results[i]._batches * sizeof(jlong));
+    pos += results[i]._batches;
+  }
+  QuickSort::sort(all, total, compare_jlong, false);
+
+  const double ops = (double)total * _batch_size;
+  tty->print_cr("ConcurrentHashTable %u threads: %.1f Mops/s, batch of %u ops ns"
+                " p50 " JLONG_FORMAT " p90 " JLONG_FORMAT " p99 " JLONG_FORMAT " max " JLONG_FORMAT,
+                nthreads, ops / (_measure_millis * 1000.0), _batch_size,
+                all[total / 2], all[total * 9 / 10], all[total * 99 / 100], all[total - 1]);
+  FREE_C_HEAP_ARRAY(jlong, all);
+}
+
+static void run_perf(uint nthreads) {
+  PerfTable* cht = new PerfTable(16);
+  Thread* thr = Thread::current();
+  for (uintptr_t v = 0; v < _prefill_entries; v++) {
+    PerfLookup lookup(v);
+    EXPECT_TRUE(cht->insert(thr, lookup, v)) << "Inserting an unique value should work.";
+  }
+
+  Semaphore done(0);
+  CHTPerfResult* results = NEW_C_HEAP_ARRAY(CHTPerfResult, nthreads, mtInternal);
+  for (uint i = 0; i < nthreads; i++) {
+    results[i]._batch_nanos = NEW_C_HEAP_ARRAY(jlong, _max_batches, mtInternal);
+    results[i]._batches = 0;
+  }
+  for (uint i = 0; i < nthreads; i++) {
+    CHTPerfThread* t = new CHTPerfThread(cht, i, &results[i], &done);
+    t->doit();
+  }
+  for (uint i = 0; i < nthreads; i++) {
+    done.wait();
+  }
+
+  report(nthreads, results);
+
+  for (uint i = 0; i < nthreads; i++) {
+    FREE_C_HEAP_ARRAY(jlong, results[i]._batch_nanos);
+  }
+  FREE_C_HEAP_ARRAY(CHTPerfResult, results);
+  delete cht;
+}
+
+TEST_VM(ConcurrentHashTable, perf) {
+  uint max_threads = MIN2(_max_threads, (uint)os::processor_count());
+  for (uint nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+    run_perf(nthreads);
+  }
+}
@@ -103,3 +103,61 @@ TEST_VM(utf8, jbyte_length) {
   }
 
 }
+
+TEST(utf8, is_legal_utf8_ascii_fast_path) {
+  unsigned char str[40];
+  for (int len = 1; len < (int) sizeof(str); len++) {
+    ::memset(str, 'a', sizeof(str));
+    EXPECT_TRUE(UTF8::is_legal_utf8(str, len, false)) << "length " << len;
+    // A bad byte must be found wherever it is, in or after the fast path.
+    for (int pos = 0; pos < len; pos++) {
+      str[pos] = 0;
+      EXPECT_FALSE(UTF8::is_legal_utf8(str, len, false)) << "zero at " << pos << " of " << len;
+      str[pos] = 0x80;
+      EXPECT_FALSE(UTF8::is_legal_utf8(str, len, false)) << "0x80 at " << pos << " of " << len;
+      str[pos] = 'a';
+    }
+  }
+
+  // Two-byte sequence following a run of ASCII.
+  ::memset(str, 'a', sizeof(str));
+  str[19] = 0xC3;
+  str[20] = 0xA9;
+  EXPECT_TRUE(UTF8::is_legal_utf8(str, 30, false));
+  EXPECT_FALSE(UTF8::is_legal_utf8(str, 20, false)) << "truncated sequence";
+}
+
+TEST_VM(utf8, jbyte_ascii_fast_path) {
+  char res[80];
+  jbyte str[30];
+
+  for (int high = -1; high < 30; high++) {
+    for (int i = 0; i < 30; i++) {
+      str[i] = (jbyte) ('a' + (i % 26));
+    }
+    if (high >= 0) {
+      str[high] = (jbyte) 0xE9; // encoded as two bytes
+    }
+    int expected = (high >= 0) ? 31 : 30;
+
+    UNICODE::as_utf8(str, 30, res, INT_MAX);
+    ASSERT_EQ(strlen(res), (size_t) expected) << "non-ASCII at " << high;
+    int j = 0;
+    for (int i = 0; i < 30; i++) {
+      if (i == high) {
+        ASSERT_EQ((unsigned char) res[j++], 0xC3u);
+        ASSERT_EQ((unsigned char) res[j++], 0xA9u);
+      } else {
+        ASSERT_EQ(res[j++], (char) str[i]) << "index " << i;
+      }
+    }
+
+    // Truncation must still stop on a character boundary inside the fast path.
+    for (int i = 1; i < 20; i++) {
+      stamp(res, sizeof(res));
+      UNICODE::as_utf8(str, 30, res, i);
+      ASSERT_LT(strlen(res), (size_t) i);
+      EXPECT_TRUE(test_stamp(res + i, sizeof(res) - i));
+    }
+  }
+}
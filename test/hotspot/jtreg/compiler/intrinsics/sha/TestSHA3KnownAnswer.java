@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Check the SHA3-224/256/384/512 intrinsics against known digests.
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:+UseSHA3Intrinsics
+ *                   compiler.intrinsics.sha.TestSHA3KnownAnswer
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:-UseSHA3Intrinsics
+ *                   compiler.intrinsics.sha.TestSHA3KnownAnswer
+ */
+
+package compiler.intrinsics.sha;
+
+import java.security.MessageDigest;
+import java.util.Arrays;
+
+public class TestSHA3KnownAnswer {
+
+    // Enough digests for implCompress and implCompressMultiBlock to be compiled.
+    private static final int ITERATIONS = 20_000;
+
+    private static final byte[][] MESSAGES = {
+        new byte[0],
+        "abc".getBytes(),
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq".getBytes(),
+        repeated((byte)0xa3, 200),
+        pattern(1000),
+    };
+
+    private static final String[] ALGORITHMS = { "SHA3-224", "SHA3-256", "SHA3-384", "SHA3-512" };
+
+    // EXPECTED[algorithm][message]
+    private static final String[][] EXPECTED = {
+        {
+            "6b4e03423667dbb73b6e15454f0eb1abd4597f9a1b078e3f5b5a6bc7",
+            "e642824c3f8cf24ad09234ee7d3c766fc9a3a5168d0c94ad73b46fdf",
+            "8a24108b154ada21c9fd5574494479ba5c7e7ab76ef264ead0fcce33",
+            "9376816aba503f72f96ce7eb65ac095deee3be4bf9bbc2a1cb7e11e0",
+            "7989dfd171a962c2ddef4ca6034a480e33f92d9ec131d6e378309cee",
+        },
+        {
+            "a7ffc6f8bf1ed76651c14756a061d662f580ff4de43b49fa82d80a4b80f8434a",
+            "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532",
+            "41c0dba2a9d6240849100376a8235e2c82e1b9998a999e21db32dd97496d3376",
+            "79f38adec5c20307a98ef76e8324afbfd46cfd81b22e3973c65fa1bd9de31787",
+            "e9612e6ecfc2fc3c9467302e2563d3155906eaf49e0bb663e460791ef2fec839",
+        },
+        {
+            "0c63a75b845e4f7d01107d852e4c2485c51a50aaaa94fc61995e71bbee983a2a"
+          + "c3713831264adb47fb6bd1e058d5f004",
+            "ec01498288516fc926459f58e2c6ad8df9b473cb0fc08c2596da7cf0e49be4b2"
+          + "98d88cea927ac7f539f1edf228376d25",
+            "991c665755eb3a4b6bbdfb75c78a492e8c56a22c5c4d7e429bfdbc32b9d4ad5a"
+          + "a04a1f076e62fea19eef51acd0657c22",
+            "1881de2ca7e41ef95dc4732b8f5f002b189cc1e42b74168ed1732649ce1dbcdd"
+          + "76197a31fd55ee989f2d7050dd473e8f",
+            "70f30a5988edf28989c9d1bce5b07762120fbf8c9f53a466db2a02aed8c0f08b"
+          + "d24f70a57da28269c565575524967823",
+        },
+        {
+            "a69f73cca23a9ac5c8b567dc185a756e97c982164fe25859e0d1dcc1475c80a6"
+          + "15b2123af1f5f94c11e3e9402c3ac558f500199d95b6d3e301758586281dcd26",
+            "b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e"
+          + "10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0",
+            "04a371e84ecfb5b8b77cb48610fca8182dd457ce6f326a0fd3d7ec2f1e91636d"
+          + "ee691fbe0c985302ba1b0d8dc78c086346b533b49c030d99a27daf1139d6e75e",
+            "e76dfad22084a8b1467fcf2ffa58361bec7628edf5f3fdc0e4805dc48caeeca8"
+          + "1b7c13c30adf52a3659584739a2df46be589c51ca1a4a8416df6545a1ce8ba00",
+            "842d060a3f1a6d6b80aaf57258f0edb7e1c0abcfa112479ac989b1527d0b0c5e"
+          + "f6da88b7f6c80cd05a7a1e08d46865bf02620044ded6ef5c21c8902a38d4f909",
+        },
+    };
+
+    private static byte[] repeated(byte b, int length) {
+        byte[] result = new byte[length];
+        Arrays.fill(result, b);
+        return result;
+    }
+
+    private static byte[] pattern(int length) {
+        byte[] result = new byte[length];
+        for (int i = 0; i < length; i++) {
+            result[i] = (byte)(i * 31 + 7);
+        }
+        return result;
+    }
+
+    private static String toHex(byte[] bytes) {
+        StringBuilder sb = new StringBuilder();
+        for (byte b : bytes) {
+            sb.append(String.format("%02x", b & 0xff));
+        }
+        return sb.toString();
+    }
+
+    public static void main(String[] args) throws Exception {
+        for (int a = 0; a < ALGORITHMS.length; a++) {
+            MessageDigest md = MessageDigest.getInstance(ALGORITHMS[a]);
+            for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+                for (int m = 0; m < MESSAGES.length; m++) {
+                    byte[] message = MESSAGES[m];
+                    // Alternate between whole-message updates, which compress
+                    // several blocks at once, and small chunks, which compress
+                    // one block at a time.
+                    if ((iteration & 1) == 0) {
+                        md.update(message);
+                    } else {
+                        for (int off = 0; off < message.length; off += 7) {
+                            md.update(message, off, Math.min(7, message.length - off));
+                        }
+                    }
+                    String digest = toHex(md.digest());
+                    if (!digest.equals(EXPECTED[a][m])) {
+                        throw new RuntimeException(ALGORITHMS[a] + " of message " + m +
+                                                   " in iteration " + iteration + ": got " + digest +
+                                                   ", expected " + EXPECTED[a][m]);
+                    }
+                }
+            }
+        }
+    }
+}
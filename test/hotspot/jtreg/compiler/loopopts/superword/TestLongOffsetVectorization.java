@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+
+import jdk.internal.misc.Unsafe;
+
+/*
+ * @test
+ * @summary SuperWord must vectorize the int inner loop of a long counted loop
+ *          whose addresses are computed in long arithmetic, with positive and
+ *          negative offsets, and produce the same results as the scalar loop.
+ * @requires vm.compiler2.enabled
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64"
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestLongOffsetVectorization
+ */
+
+public class TestLongOffsetVectorization {
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    private static final long BASE = UNSAFE.arrayBaseOffset(int[].class);
+    private static final long SCALE_SHIFT = 2;
+
+    private static final int SIZE = 1024;
+    private static final long OFFSET = 8;
+    private static final int UNTOUCHED = -1;
+
+    private static final int[] src = new int[SIZE];
+    private static final int[] dst = new int[SIZE];
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("--add-exports", "java.base/jdk.internal.misc=ALL-UNNAMED");
+    }
+
+    // dst[i] = src[i + OFFSET] + 1, for 0 <= i < n
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR, ">0", IRNode.STORE_VECTOR, ">0"})
+    public static void addOffset(int[] d, int[] s, long n) {
+        for (long i = 0; i < n; i++) {
+            UNSAFE.putInt(d, BASE + (i << SCALE_SHIFT), UNSAFE.getInt(s, BASE + ((i + OFFSET) << SCALE_SHIFT)) + 1);
+        }
+    }
+
+    // dst[i] = src[i - OFFSET] + 1, for OFFSET <= i < n
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR, ">0", IRNode.STORE_VECTOR, ">0"})
+    public static void subOffset(int[] d, int[] s, long n) {
+        for (long i = OFFSET; i < n; i++) {
+            UNSAFE.putInt(d, BASE + (i << SCALE_SHIFT), UNSAFE.getInt(s, BASE + ((i - OFFSET) << SCALE_SHIFT)) + 1);
+        }
+    }
+
+    // dst[i + OFFSET] = src[i] + 1 with a negative long constant added to the
+    // store index, for OFFSET <= i + OFFSET < n
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR, ">0", IRNode.STORE_VECTOR, ">0"})
+    public static void negativeOffset(int[] d, int[] s, long n) {
+        for (long i = OFFSET; i < n; i++) {
+            UNSAFE.putInt(d, BASE + ((i + (-OFFSET)) << SCALE_SHIFT), UNSAFE.getInt(s, BASE + (i << SCALE_SHIFT)) + 1);
+        }
+    }
+
+    private static void reset() {
+        for (int i = 0; i < SIZE; i++) {
+            src[i] = i * 3;
+            dst[i] = UNTOUCHED;
+        }
+    }
+
+    private static void check(String name, long n, int index, int expected) {
+        if (dst[index] != expected) {
+            throw new RuntimeException(name + " with n = " + n + ": dst[" + index + "] = " +
+                                       dst[index] + ", expected " + expected);
+        }
+    }
+
+    // Loop bounds around the vector width and the end of the arrays.
+    private static final long[] BOUNDS = { 0, 1, OFFSET, OFFSET + 1, 63, 64, 65,
+                                           SIZE - OFFSET - 1, SIZE - OFFSET };
+
+    @Run(test = "addOffset")
+    public static void runAddOffset() {
+        for (long n : BOUNDS) {
+            reset();
+            addOffset(dst, src, n);
+            for (int i = 0; i < SIZE; i++) {
+                check("addOffset", n, i, i < n ? src[i + (int) OFFSET] + 1 : UNTOUCHED);
+            }
+        }
+    }
+
+    @Run(test = "subOffset")
+    public static void runSubOffset() {
+        for (long n : BOUNDS) {
+            reset();
+            subOffset(dst, src, n + OFFSET);
+            for (int i = 0; i < SIZE; i++) {
+                boolean written = i >= OFFSET && i < n + OFFSET;
+                check("subOffset", n + OFFSET, i, written ? src[i - (int) OFFSET] + 1 : UNTOUCHED);
+            }
+        }
+    }
+
+    @Run(test = "negativeOffset")
+    public static void runNegativeOffset() {
+        for (long n : BOUNDS) {
+            reset();
+            negativeOffset(dst, src, n + OFFSET);
+            for (int i = 0; i < SIZE; i++) {
+                check("negativeOffset", n + OFFSET, i, i < n ? src[i + (int) OFFSET] + 1 : UNTOUCHED);
+            }
+        }
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEagerReclaimHumongousObjArrays
+ * @summary Check that G1 eagerly reclaims dead humongous object arrays at the
+ *          next young GC, and that young objects referenced from a live
+ *          humongous object array survive young GCs.
+ * @requires vm.gc.G1 & vm.bits == 64
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver gc.g1.TestEagerReclaimHumongousObjArrays
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+import sun.hotspot.WhiteBox;
+
+public class TestEagerReclaimHumongousObjArrays {
+
+    private static final Pattern RECLAIMED_PATTERN =
+        Pattern.compile("Reclaimed humongous region \\d+ \\(object size (\\d+) @");
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-XX:G1HeapRegionSize=1M",
+            "-Xms128M",
+            "-Xmx128M",
+            // Object arrays are not reclaimed during concurrent marking.
+            "-XX:-G1UseAdaptiveIHOP",
+            "-XX:InitiatingHeapOccupancyPercent=100",
+            "-XX:+VerifyAfterGC",
+            "-Xlog:gc,gc+humongous=debug",
+            GCTest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getStdout());
+        output.shouldHaveExitValue(0);
+
+        long deadSize = Long.parseLong(output.firstMatch("DEAD_SIZE_WORDS=(\\d+)", 1));
+        long liveSize = Long.parseLong(output.firstMatch("LIVE_SIZE_WORDS=(\\d+)", 1));
+        Asserts.assertNE(deadSize, liveSize, "The arrays must be told apart by size");
+
+        boolean deadReclaimed = false;
+        Matcher m = RECLAIMED_PATTERN.matcher(output.getStdout());
+        while (m.find()) {
+            long size = Long.parseLong(m.group(1));
+            Asserts.assertNE(size, liveSize, "The live humongous object array must not be reclaimed");
+            if (size == deadSize) {
+                deadReclaimed = true;
+            }
+        }
+        Asserts.assertTrue(deadReclaimed, "The dead humongous object array must be eagerly reclaimed");
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        // All span several 1M regions, and have different sizes.
+        private static final int LIVE_LENGTH = 3 * 128 * 1024;
+        private static final int DEAD_LENGTH = 5 * 128 * 1024;
+        private static final int FILLER_LENGTH = 4 * 128 * 1024;
+        private static final int ITERATIONS = 10;
+
+        private static Object[] live;
+
+        private static void fill(Object[] array, int iteration) {
+            for (int i = 0; i < array.length; i += 7) {
+                array[i] = new long[] { i, iteration };
+            }
+        }
+
+        private static void check(Object[] array, int iteration) {
+            for (int i = 0; i < array.length; i += 7) {
+                long[] value = (long[]) array[i];
+                if (value[0] != i || value[1] != iteration) {
+                    throw new RuntimeException("Wrong value at index " + i + " after iteration " + iteration +
+                                               ": " + value[0] + ", " + value[1]);
+                }
+            }
+        }
+
+        public static void main(String[] args) {
+            live = new Object[LIVE_LENGTH];
+            Asserts.assertTrue(WB.g1IsHumongous(live), "The live array must be humongous");
+            System.out.println("LIVE_SIZE_WORDS=" + WB.getObjectSize(live) / 8);
+
+            // Store young objects into the live array across young GCs. The
+            // array must keep them alive, and must not be reclaimed itself.
+            for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+                fill(live, iteration);
+                WB.youngGC();
+                check(live, iteration);
+                WB.youngGC();
+                check(live, iteration);
+            }
+
+            // A dead humongous object array that references young objects is
+            // reclaimed at the next young GC.
+            Object[] dead = new Object[DEAD_LENGTH];
+            Asserts.assertTrue(WB.g1IsHumongous(dead), "The dead array must be humongous");
+            System.out.println("DEAD_SIZE_WORDS=" + WB.getObjectSize(dead) / 8);
+            fill(dead, 0);
+            dead = null;
+            WB.youngGC();
+
+            // Reuse the freed regions, so that any stale remembered set
+            // entries of the reclaimed array point into new objects.
+            for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+                Object[] filler = new Object[FILLER_LENGTH];
+                fill(filler, iteration);
+                fill(live, iteration);
+                WB.youngGC();
+                check(filler, iteration);
+                check(live, iteration);
+            }
+        }
+    }
+}
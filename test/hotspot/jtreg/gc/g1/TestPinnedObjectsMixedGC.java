@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test
+ * @summary Pin objects in old regions after marking so that some of them are
+ *          optional collection set regions of the following mixed GCs. Those
+ *          regions must be dropped from the optional collection set cleanly.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm/native
+ *    -Xbootclasspath/a:.
+ *    -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *    -XX:+UseG1GC -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m
+ *    -XX:MaxTenuringThreshold=0 -XX:MaxGCPauseMillis=1 -XX:GCPauseIntervalMillis=2
+ *    -XX:G1MixedGCCountTarget=16 -XX:G1MixedGCLiveThresholdPercent=100
+ *    -XX:G1HeapWastePercent=0
+ *    -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *    -Xlog:gc,gc+ergo+cset=debug
+ *    gc.g1.TestPinnedObjectsMixedGC
+ */
+
+import java.util.ArrayList;
+
+import sun.hotspot.WhiteBox;
+
+public class TestPinnedObjectsMixedGC {
+    static { System.loadLibrary("TestPinnedObjectsMixedGC"); }
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int ARRAY_SIZE = 16 * 1024;
+    private static final int NUM_OLD_REGIONS = 32;
+
+    private static native boolean pinInNative(byte[] array);
+    private static native int pinnedCount();
+    private static native void unpinAll();
+
+    public static void main(String[] args) throws Exception {
+        int arraysPerRegion = WB.g1RegionSize() / ARRAY_SIZE;
+        ArrayList<byte[]> live = new ArrayList<>();
+
+        // Fill old regions with arrays and leave every other array live so that
+        // all of these regions become mixed GC candidates.
+        byte[][] arrays = new byte[NUM_OLD_REGIONS * arraysPerRegion][];
+        for (int i = 0; i < arrays.length; i++) {
+            arrays[i] = new byte[ARRAY_SIZE];
+        }
+        WB.youngGC();
+        for (int i = 0; i < arrays.length; i += 2) {
+            live.add(arrays[i]);
+        }
+        arrays = null;
+
+        WB.g1StartConcMarkCycle();
+        while (WB.g1InConcurrentMark()) {
+            Thread.sleep(10);
+        }
+
+        // Pin roughly one array per region. The regions were unpinned when the
+        // candidates were selected, so some of them end up in the optional
+        // part of the collection set.
+        ArrayList<Thread> pinners = new ArrayList<>();
+        for (int i = 0; i < live.size(); i += arraysPerRegion / 2) {
+            byte[] array = live.get(i);
+            int expected = pinnedCount() + 1;
+            Thread t = new Thread(() -> {
+                if (!pinInNative(array)) {
+                    throw new RuntimeException("Could not pin array");
+                }
+            });
+            t.start();
+            pinners.add(t);
+            while (pinnedCount() != expected) {
+                Thread.sleep(1);
+            }
+        }
+
+        try {
+            // Prepare mixed, then the mixed GCs.
+            for (int i = 0; i < 20; i++) {
+                WB.youngGC();
+            }
+        } finally {
+            unpinAll();
+        }
+        for (Thread t : pinners) {
+            t.join();
+        }
+        WB.youngGC();
+
+        System.out.println(live.size());
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Native support for TestPinnedObjectsMixedGC test.
+ */
+
+#include "jni.h"
+
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Only one thread pins at a time; the Java side waits for the count to
+// change before it starts the next one.
+static volatile jint pinned_count = 0;
+static volatile int release_critical = 0;
+
+JNIEXPORT jboolean JNICALL
+Java_gc_g1_TestPinnedObjectsMixedGC_pinInNative(JNIEnv* env, jclass cls, jbyteArray array) {
+    void* native_array = (*env)->GetPrimitiveArrayCritical(env, array, 0);
+
+    if (native_array == NULL) {
+        return JNI_FALSE;
+    }
+
+    pinned_count++;
+
+    while (!release_critical) {
+#ifdef WINDOWS
+        Sleep(1);
+#else
+        usleep(1000);
+#endif
+    }
+
+    (*env)->ReleasePrimitiveArrayCritical(env, array, native_array, 0);
+
+    return JNI_TRUE;
+}
+
+JNIEXPORT jint JNICALL Java_gc_g1_TestPinnedObjectsMixedGC_pinnedCount(JNIEnv* env, jclass cls)
+{
+    return pinned_count;
+}
+
+JNIEXPORT void JNICALL Java_gc_g1_TestPinnedObjectsMixedGC_unpinAll(JNIEnv* env, jclass cls)
+{
+    release_critical = 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Classes preloaded from PreloadClassListFile are reported to JVMTI
+ *          agents through ClassFileLoadHook and ClassLoad events.
+ * @requires vm.jvmti
+ * @library /test/lib
+ * @run main/othervm/native ClassPreloaderJvmti
+ */
+
+import java.io.File;
+import java.io.PrintWriter;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class ClassPreloaderJvmti {
+
+    private static final String AGENT_LIB = "ClassPreloaderJvmti";
+    private static final int NUM_PRELOADED = 4;
+
+    // Only named in the class list, never referenced by the test itself.
+    static class Preloaded0 {}
+    static class Preloaded1 {}
+    static class Preloaded2 {}
+    static class Preloaded3 {}
+
+    private static native int classFileLoadHookCount();
+    private static native int classLoadCount();
+
+    public static void main(String[] args) throws Exception {
+        if (args.length == 0) {
+            File classList = File.createTempFile(AGENT_LIB, ".classlist");
+            classList.deleteOnExit();
+            try (PrintWriter out = new PrintWriter(classList)) {
+                out.println("# Classes for ClassPreloaderJvmti");
+                for (int i = 0; i < NUM_PRELOADED; i++) {
+                    out.println("ClassPreloaderJvmti$Preloaded" + i);
+                }
+            }
+
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-agentlib:" + AGENT_LIB,
+                "-Djava.library.path=" + System.getProperty("java.library.path"),
+                "-XX:PreloadClassListFile=" + classList.getAbsolutePath(),
+                // The agent counts events without synchronization.
+                "-XX:PreloadClassThreads=1",
+                "-Xlog:class+load=info",
+                ClassPreloaderJvmti.class.getName(),
+                "test");
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            output.shouldHaveExitValue(0);
+            output.shouldContain("Preloaded " + NUM_PRELOADED + " of " + NUM_PRELOADED + " classes");
+        } else {
+            System.loadLibrary(AGENT_LIB);
+            // The classes are loaded in the background; wait for the events.
+            long deadline = System.currentTimeMillis() + 60_000;
+            while (classFileLoadHookCount() < NUM_PRELOADED || classLoadCount() < NUM_PRELOADED) {
+                if (System.currentTimeMillis() > deadline) {
+                    throw new RuntimeException("Missed events for preloaded classes: " +
+                                               classFileLoadHookCount() + " ClassFileLoadHook, " +
+                                               classLoadCount() + " ClassLoad, expected " +
+                                               NUM_PRELOADED);
+                }
+                Thread.sleep(10);
+            }
+        }
+    }
+}
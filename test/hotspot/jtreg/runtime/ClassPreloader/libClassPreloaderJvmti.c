@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <string.h>
+#include "jvmti.h"
+#include "jni.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRELOADED_PREFIX "ClassPreloaderJvmti$Preloaded"
+
+static volatile jint class_file_load_hook_count = 0;
+static volatile jint class_load_count = 0;
+
+static void JNICALL
+ClassFileLoadHook(jvmtiEnv* jvmti, JNIEnv* env, jclass class_being_redefined,
+                  jobject loader, const char* name, jobject protection_domain,
+                  jint class_data_len, const unsigned char* class_data,
+                  jint* new_class_data_len, unsigned char** new_class_data) {
+    if (name != NULL && strncmp(name, PRELOADED_PREFIX, strlen(PRELOADED_PREFIX)) == 0) {
+        class_file_load_hook_count++;
+    }
+}
+
+static void JNICALL
+ClassLoad(jvmtiEnv* jvmti, JNIEnv* env, jthread thread, jclass klass) {
+    char* signature = NULL;
+    if ((*jvmti)->GetClassSignature(jvmti, klass, &signature, NULL) != JVMTI_ERROR_NONE) {
+        return;
+    }
+    // Skip the leading 'L' of the signature.
+    if (strncmp(signature + 1, PRELOADED_PREFIX, strlen(PRELOADED_PREFIX)) == 0) {
+        class_load_count++;
+    }
+    (*jvmti)->Deallocate(jvmti, (unsigned char*)signature);
+}
+
+JNIEXPORT jint JNICALL
+Agent_OnLoad(JavaVM* jvm, char* options, void* reserved) {
+    jvmtiEnv* jvmti = NULL;
+    jvmtiCapabilities caps;
+    jvmtiEventCallbacks callbacks;
+
+    if ((*jvm)->GetEnv(jvm, (void**)&jvmti, JVMTI_VERSION) != JNI_OK || jvmti == NULL) {
+        return JNI_ERR;
+    }
+
+    memset(&caps, 0, sizeof(caps));
+    caps.can_generate_all_class_hook_events = 1;
+    if ((*jvmti)->AddCapabilities(jvmti, &caps) != JVMTI_ERROR_NONE) {
+        return JNI_ERR;
+    }
+
+    memset(&callbacks, 0, sizeof(callbacks));
+    callbacks.ClassFileLoadHook = &ClassFileLoadHook;
+    callbacks.ClassLoad = &ClassLoad;
+    if ((*jvmti)->SetEventCallbacks(jvmti, &callbacks, sizeof(callbacks)) != JVMTI_ERROR_NONE) {
+        return JNI_ERR;
+    }
+    if ((*jvmti)->SetEventNotificationMode(jvmti, JVMTI_ENABLE, JVMTI_EVENT_CLASS_FILE_LOAD_HOOK, NULL) != JVMTI_ERROR_NONE ||
+        (*jvmti)->SetEventNotificationMode(jvmti, JVMTI_ENABLE, JVMTI_EVENT_CLASS_LOAD, NULL) != JVMTI_ERROR_NONE) {
+        return JNI_ERR;
+    }
+    return JNI_OK;
+}
+
+JNIEXPORT jint JNICALL
+Java_ClassPreloaderJvmti_classFileLoadHookCount(JNIEnv* env, jclass cls) {
+    return class_file_load_hook_count;
+}
+
+JNIEXPORT jint JNICALL
+Java_ClassPreloaderJvmti_classLoadCount(JNIEnv* env, jclass cls) {
+    return class_load_count;
+}
+
+#ifdef __cplusplus
+}
+#endif
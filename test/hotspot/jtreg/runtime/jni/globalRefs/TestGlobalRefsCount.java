@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Create and delete JNI global and weak global refs from several
+ *          threads. The counts reported by Thread.print must not include the
+ *          entries the threads cache, neither while the threads are alive nor
+ *          after they have exited.
+ * @comment -Xint keeps the compilers from making global refs of their own.
+ * @run main/othervm/native -Xint TestGlobalRefsCount
+ */
+
+import java.lang.management.ManagementFactory;
+import java.lang.ref.Reference;
+import java.util.concurrent.CountDownLatch;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import javax.management.ObjectName;
+
+public class TestGlobalRefsCount {
+    static { System.loadLibrary("TestGlobalRefsCount"); }
+
+    private static final int NUM_THREADS = 8;
+    // Several times the size of the per-thread cache.
+    private static final int NUM_REFS = 100;
+
+    private static final Pattern REFS_PATTERN =
+        Pattern.compile("JNI global refs: (\\d+), weak refs: (\\d+)");
+
+    // Returns the handles of numRefs new global or weak global refs to o.
+    private static native long[] makeRefs(Object o, int numRefs, boolean weak);
+    // Deletes the refs at the even indices, or all refs, and clears their slots.
+    private static native void deleteRefs(long[] refs, boolean weak, boolean all);
+
+    private static long[] threadPrintCounts() throws Exception {
+        String output = (String) ManagementFactory.getPlatformMBeanServer().invoke(
+            new ObjectName("com.sun.management:type=DiagnosticCommand"),
+            "threadPrint",
+            new Object[] { new String[0] },
+            new String[] { String[].class.getName() });
+        Matcher m = REFS_PATTERN.matcher(output);
+        if (!m.find()) {
+            throw new RuntimeException("No JNI refs line in Thread.print output:\n" + output);
+        }
+        return new long[] { Long.parseLong(m.group(1)), Long.parseLong(m.group(2)) };
+    }
+
+    private static void checkCounts(String when, long[] base, long expectedLive) throws Exception {
+        long[] counts = threadPrintCounts();
+        System.out.println(when + ": global refs " + counts[0] + ", weak refs " + counts[1]);
+        if (counts[0] != base[0] + expectedLive) {
+            throw new RuntimeException(when + ": expected " + (base[0] + expectedLive) +
+                                       " global refs, got " + counts[0]);
+        }
+        if (counts[1] != base[1] + expectedLive) {
+            throw new RuntimeException(when + ": expected " + (base[1] + expectedLive) +
+                                       " weak refs, got " + counts[1]);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Warm up the diagnostic command path before taking the baseline.
+        threadPrintCounts();
+        long[] base = threadPrintCounts();
+
+        Object referent = new Object();
+        long[][] globals = new long[NUM_THREADS][];
+        long[][] weaks = new long[NUM_THREADS][];
+        CountDownLatch created = new CountDownLatch(NUM_THREADS);
+        CountDownLatch exit = new CountDownLatch(1);
+        Thread[] threads = new Thread[NUM_THREADS];
+        for (int i = 0; i < NUM_THREADS; i++) {
+            final int id = i;
+            threads[i] = new Thread(() -> {
+                globals[id] = makeRefs(referent, NUM_REFS, false);
+                weaks[id] = makeRefs(referent, NUM_REFS, true);
+                deleteRefs(globals[id], false, false);
+                deleteRefs(weaks[id], true, false);
+                created.countDown();
+                try {
+                    exit.await();
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            });
+            threads[i].start();
+        }
+
+        long live = NUM_THREADS * (NUM_REFS / 2);
+        created.await();
+        checkCounts("Threads alive", base, live);
+
+        exit.countDown();
+        for (Thread t : threads) {
+            t.join();
+        }
+        checkCounts("Threads exited", base, live);
+
+        for (int i = 0; i < NUM_THREADS; i++) {
+            deleteRefs(globals[i], false, true);
+            deleteRefs(weaks[i], true, true);
+        }
+        checkCounts("Refs deleted", base, 0);
+        Reference.reachabilityFence(referent);
+    }
+}
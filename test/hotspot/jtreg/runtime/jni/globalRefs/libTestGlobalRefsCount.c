@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Native support for TestGlobalRefsCount test.
+ */
+
+#include <stdint.h>
+
+#include "jni.h"
+
+JNIEXPORT jlongArray JNICALL
+Java_TestGlobalRefsCount_makeRefs(JNIEnv* env, jclass jclazz,
+                                  jobject o, jint num_refs, jboolean weak) {
+  jlongArray result = (*env)->NewLongArray(env, num_refs);
+  jint i;
+  if (result == NULL) {
+    return NULL;
+  }
+  for (i = 0; i < num_refs; i++) {
+    jobject ref = weak ? (*env)->NewWeakGlobalRef(env, o) : (*env)->NewGlobalRef(env, o);
+    jlong value = (jlong)(intptr_t)ref;
+    if (ref == NULL) {
+      (*env)->FatalError(env, "Could not create global ref");
+    }
+    (*env)->SetLongArrayRegion(env, result, i, 1, &value);
+  }
+  return result;
+}
+
+JNIEXPORT void JNICALL
+Java_TestGlobalRefsCount_deleteRefs(JNIEnv* env, jclass jclazz,
+                                    jlongArray refs, jboolean weak, jboolean all) {
+  jint length = (*env)->GetArrayLength(env, refs);
+  jint i;
+  for (i = 0; i < length; i++) {
+    jlong value;
+    (*env)->GetLongArrayRegion(env, refs, i, 1, &value);
+    if (value != 0 && (all || (i % 2) == 0)) {
+      jobject ref = (jobject)(intptr_t)value;
+      if (weak) {
+        (*env)->DeleteWeakGlobalRef(env, ref);
+      } else {
+        (*env)->DeleteGlobalRef(env, ref);
+      }
+      value = 0;
+      (*env)->SetLongArrayRegion(env, refs, i, 1, &value);
+    }
+  }
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test CompilerMemoryStatisticTest
+ * @summary Test of diagnostic command Compiler.memory
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run testng/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                     -XX:+CompilerMemoryStatistics CompilerMemoryStatisticTest
+ */
+
+import java.lang.reflect.Method;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+import sun.hotspot.WhiteBox;
+
+public class CompilerMemoryStatisticTest {
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int C1_LEVEL = 1;
+    private static final int C2_LEVEL = 4;
+
+    private static final Pattern HEADER_PATTERN =
+        Pattern.compile("Compilation memory statistics: (\\d+) compilations, largest (\\d+):");
+    private static final Pattern ENTRY_PATTERN =
+        Pattern.compile("^\\s*(\\d+)\\s+(\\d+)\\s+(\\d+)\\s+(\\S+)$");
+
+    public static int c1Method(int x) {
+        return x * 31 + 7;
+    }
+
+    public static long c2Method(long[] values) {
+        long sum = 0;
+        for (long v : values) {
+            sum += v * v;
+        }
+        return sum;
+    }
+
+    private static void compile(Method m, int level) throws Exception {
+        Assert.assertTrue(WB.enqueueMethodForCompilation(m, level), "Could not enqueue " + m);
+        while (WB.getMethodCompilationLevel(m) != level) {
+            if (!WB.isMethodQueuedForCompilation(m) && WB.getMethodCompilationLevel(m) != level) {
+                Assert.assertTrue(WB.enqueueMethodForCompilation(m, level), "Could not enqueue " + m);
+            }
+            Thread.sleep(10);
+        }
+    }
+
+    public void run(CommandExecutor executor) throws Exception {
+        compile(CompilerMemoryStatisticTest.class.getMethod("c1Method", int.class), C1_LEVEL);
+        compile(CompilerMemoryStatisticTest.class.getMethod("c2Method", long[].class), C2_LEVEL);
+
+        OutputAnalyzer output = executor.execute("Compiler.memory");
+        String[] lines = output.getStdout().split("\\R");
+
+        Matcher header = null;
+        int headerLine = -1;
+        for (int i = 0; i < lines.length; i++) {
+            Matcher m = HEADER_PATTERN.matcher(lines[i]);
+            if (m.find()) {
+                header = m;
+                headerLine = i;
+                break;
+            }
+        }
+        Assert.assertNotNull(header, "No header in output:\n" + output.getStdout());
+        long numCompilations = Long.parseLong(header.group(1));
+        int numEntries = Integer.parseInt(header.group(2));
+        Assert.assertTrue(numCompilations >= 2, "Expected at least two compilations, got " + numCompilations);
+        Assert.assertTrue(numEntries >= 2 && numEntries <= numCompilations,
+                          "Unexpected number of entries: " + numEntries);
+        Assert.assertTrue(lines[headerLine + 1].contains("peak (bytes)"), "No column header: " + lines[headerLine + 1]);
+
+        boolean foundC1 = false;
+        boolean foundC2 = false;
+        long previousPeak = Long.MAX_VALUE;
+        int entries = 0;
+        for (int i = headerLine + 2; i < lines.length; i++) {
+            Matcher m = ENTRY_PATTERN.matcher(lines[i]);
+            if (!m.matches()) {
+                continue;
+            }
+            entries++;
+            long peak = Long.parseLong(m.group(1));
+            int level = Integer.parseInt(m.group(3));
+            String method = m.group(4);
+            Assert.assertTrue(peak > 0, "Zero arena peak: " + lines[i]);
+            Assert.assertTrue(peak <= previousPeak, "Entries are not sorted by peak: " + lines[i]);
+            previousPeak = peak;
+            if (method.startsWith("CompilerMemoryStatisticTest.c1Method(") && level == C1_LEVEL) {
+                foundC1 = true;
+            }
+            if (method.startsWith("CompilerMemoryStatisticTest.c2Method(") && level == C2_LEVEL) {
+                foundC2 = true;
+            }
+        }
+        Assert.assertEquals(entries, numEntries, "Number of entries printed");
+        Assert.assertTrue(foundC1, "No C1 compilation of c1Method in output:\n" + output.getStdout());
+        Assert.assertTrue(foundC2, "No C2 compilation of c2Method in output:\n" + output.getStdout());
+
+        // Nothing is as large as this.
+        output = executor.execute("Compiler.memory minsize=1T");
+        output.shouldContain("Compilation memory statistics:");
+        for (String line : output.getStdout().split("\\R")) {
+            Assert.assertFalse(ENTRY_PATTERN.matcher(line).matches(), "Unexpected entry with minsize=1T: " + line);
+        }
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Class loading and unloading churn.
+ *
+ * Each invocation defines a copy of a small class in a fresh class loader
+ * and then drops both, so concurrent or stop-the-world class unloading has
+ * a steady supply of dead loaders to process. {@code loadersPerGC} controls
+ * how many loaders die between explicit collections.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = { "-Xms1g", "-Xmx1g" })
+public class ClassUnloading {
+
+    @Param({"100", "10000"})
+    public int loadersPerGC;
+
+    public static class Payload {
+        public static int value = 42;
+    }
+
+    static final class OneShotLoader extends ClassLoader {
+        OneShotLoader() {
+            super(null);
+        }
+
+        Class<?> define(String name, byte[] bytes) {
+            return defineClass(name, bytes, 0, bytes.length);
+        }
+    }
+
+    byte[] payloadBytes;
+    String payloadName;
+    int loaded;
+
+    @Setup
+    public void setup() throws IOException {
+        payloadName = Payload.class.getName();
+        String resource = payloadName.replace('.', '/') + ".class";
+        try (InputStream in = ClassUnloading.class.getClassLoader().getResourceAsStream(resource)) {
+            payloadBytes = in.readAllBytes();
+        }
+        loaded = 0;
+    }
+
+    @Benchmark
+    public Class<?> loadAndDrop() {
+        Class<?> c = new OneShotLoader().define(payloadName, payloadBytes);
+        if (++loaded == loadersPerGC) {
+            loaded = 0;
+            System.gc();
+        }
+        return c;
+    }
+}
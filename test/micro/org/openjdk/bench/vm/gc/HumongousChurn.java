@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Allocation and reclamation of large arrays.
+ *
+ * With G1 and a 1 MB region size, every array allocated here is humongous.
+ * A few of them are kept alive in a small ring so that both eager
+ * reclamation of dead humongous objects and retention of live ones are
+ * exercised.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = { "-Xms2g", "-Xmx2g", "-XX:G1HeapRegionSize=1m" })
+public class HumongousChurn {
+
+    @Param({"524288", "4194304"})
+    public int size;
+
+    @Param({"0", "16"})
+    public int retained;
+
+    byte[][] ring;
+    int index;
+
+    @Setup
+    public void setup() {
+        ring = new byte[Math.max(retained, 1)][];
+        index = 0;
+    }
+
+    @Benchmark
+    public byte[] allocate() {
+        byte[] array = new byte[size];
+        if (retained > 0) {
+            int i = index;
+            ring[i] = array;
+            index = (i + 1 == retained) ? 0 : i + 1;
+        }
+        return array;
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Remembered set and card scanning pressure from old-to-young references.
+ *
+ * A large array is promoted to the old generation during setup. The
+ * benchmark then stores freshly allocated objects into it, with a stride
+ * that controls how many distinct cards are dirtied between collections.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = { "-Xms2g", "-Xmx2g" })
+public class OldToYoung {
+
+    @Param({"1", "16", "128"})
+    public int stride;
+
+    static final int OLD_SLOTS = 4 * 1024 * 1024;
+
+    Object[] old;
+    int index;
+    int offset;
+
+    @Setup
+    public void setup() {
+        old = new Object[OLD_SLOTS];
+        for (int i = 0; i < OLD_SLOTS; i++) {
+            old[i] = new Object();
+        }
+        // Promote the array and its contents before measuring.
+        for (int i = 0; i < 3; i++) {
+            System.gc();
+        }
+        index = 0;
+        offset = 0;
+    }
+
+    @Benchmark
+    public void storeYoungIntoOld() {
+        int i = index;
+        old[i] = new Object();
+        i += stride;
+        if (i >= OLD_SLOTS) {
+            offset = (offset + 1) % stride;
+            i = offset;
+        }
+        index = i;
+    }
+}
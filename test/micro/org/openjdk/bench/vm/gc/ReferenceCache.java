@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.lang.ref.Reference;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Reference processing cost for caches built from soft or weak references.
+ *
+ * A fixed-size table of references is refilled as entries are cleared, so
+ * every collection discovers and processes a steady number of references.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = { "-Xms1g", "-Xmx1g" })
+public class ReferenceCache {
+
+    @Param({"weak", "soft"})
+    public String kind;
+
+    @Param({"10000", "1000000"})
+    public int entries;
+
+    Reference<?>[] cache;
+    boolean soft;
+    int index;
+
+    @Setup
+    public void setup() {
+        soft = kind.equals("soft");
+        cache = new Reference<?>[entries];
+        for (int i = 0; i < entries; i++) {
+            cache[i] = newReference(i);
+        }
+        index = 0;
+    }
+
+    private Reference<?> newReference(int value) {
+        Object referent = new long[] { value };
+        return soft ? new SoftReference<>(referent) : new WeakReference<>(referent);
+    }
+
+    @Benchmark
+    public Object lookup() {
+        int i = index;
+        Reference<?> ref = cache[i];
+        Object value = ref.get();
+        if (value == null) {
+            cache[i] = newReference(i);
+        }
+        index = (i + 1 == entries) ? 0 : i + 1;
+        return value;
+    }
+}
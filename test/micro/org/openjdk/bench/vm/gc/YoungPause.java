@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Young collection cost as a function of the surviving young live set.
+ *
+ * A ring of {@code liveObjects} young objects is kept reachable and
+ * constantly replaced, so every young collection has to copy roughly that
+ * many objects. Run with {@code -prof jfr} or {@code -Xlog:gc+phases=debug}
+ * to get the per-phase breakdown of the resulting pauses.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = { "-Xms2g", "-Xmx2g", "-Xmn512m" })
+public class YoungPause {
+
+    @Param({"1000", "100000", "1000000"})
+    public int liveObjects;
+
+    static final class Node {
+        Node next;
+        long payload;
+
+        Node(Node next, long payload) {
+            this.next = next;
+            this.payload = payload;
+        }
+    }
+
+    Node[] ring;
+    int index;
+
+    @Setup
+    public void setup() {
+        ring = new Node[liveObjects];
+        for (int i = 0; i < liveObjects; i++) {
+            ring[i] = new Node(null, i);
+        }
+        index = 0;
+    }
+
+    @Benchmark
+    public Node replaceLive() {
+        int i = index;
+        Node n = new Node(ring[i], i);
+        ring[i] = new Node(null, i);
+        index = (i + 1 == ring.length) ? 0 : i + 1;
+        return n;
+    }
+
+    @Benchmark
+    public Object garbageOnly() {
+        return new Node(null, index);
+    }
+}